@@ -0,0 +1,140 @@
+/*
+ * catch_benchmarks.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+#if defined(CATCH_ENABLED) && defined(CATCH_CONFIG_ENABLE_BENCHMARKING)
+#include "catch.hpp"
+
+#include "lab_k29_11_09_20.h"
+#include "lab_k29_25_09_20_templates/func.h"
+#include "list/list.h"
+#include "rational.h"
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+// Benchmarks are hidden ([.]) from usual test runs, run them with bench_catch::main or the "[benchmark]" tag
+
+/**
+ * \brief Disables std::cout while in scope
+ *
+ * lab_k29_11_09_20::string prints from every constructor, without this we would measure the console.
+ */
+class SilentCout {
+private:
+	std::streambuf* buffer;
+public:
+	SilentCout(): buffer{std::cout.rdbuf(nullptr)} {}
+	~SilentCout() {
+		std::cout.rdbuf(buffer);
+		std::cout.clear();
+	}
+};
+
+TEST_CASE("DoublyLinkedList benchmarks", "[.][benchmark][list]") {
+	BENCHMARK("append 1000 values") {
+		DoublyLinkedList<int> list;
+		for (int i = 0; i < 1000; i++) {
+			list.append(i);
+		}
+		return list.size();
+	};
+
+	DoublyLinkedList<int> list;
+	for (int i = 0; i < 1000; i++) {
+		list.append(i);
+	}
+	BENCHMARK("operator[] first of 1000") {
+		return list[0];
+	};
+	BENCHMARK("operator[] middle of 1000") {
+		return list[500];
+	};
+	BENCHMARK("operator[] last of 1000") {
+		return list[999];
+	};
+}
+
+TEST_CASE("Rational::GCD benchmarks", "[.][benchmark][rational]") {
+	volatile int small_a = 10, small_b = 15;
+	// consecutive Fibonacci numbers - the largest number of steps for int
+	volatile int fib_a = 1134903170, fib_b = 701408733;
+
+	BENCHMARK("GCD(10, 15)") {
+		return Rational::GCD(small_a, small_b);
+	};
+	BENCHMARK("GCD of consecutive Fibonacci numbers") {
+		return Rational::GCD(fib_a, fib_b);
+	};
+}
+
+TEST_CASE("Rational arithmetic benchmarks", "[.][benchmark][rational]") {
+	volatile int numerator = 355, denominator = 113;
+	Rational a{numerator, denominator}, b{denominator, numerator + 1};
+
+	BENCHMARK("Rational +") {
+		return a + b;
+	};
+	BENCHMARK("Rational *") {
+		return a * b;
+	};
+	BENCHMARK("Rational /") {
+		return a / b;
+	};
+}
+
+TEST_CASE("square<T> benchmarks", "[.][benchmark][template]") {
+	volatile int int_value = 12345;
+	volatile double double_value = 0.1;
+
+	BENCHMARK("square<int>") {
+		return square<int>(int_value);
+	};
+	BENCHMARK("square<double>") {
+		return square<double>(double_value);
+	};
+}
+
+TEST_CASE("string copy and move benchmarks", "[.][benchmark][string]") {
+	using lab_k29_11_09_20::string;
+	SilentCout silent;
+
+	string original{"hello world, a string long enough to see the cost of copying"};
+
+	BENCHMARK_ADVANCED("copy constructor")(Catch::Benchmark::Chronometer meter) {
+		std::vector<Catch::Benchmark::destructable_object<string>> copies(meter.runs());
+		meter.measure([&](int i) {
+			copies[i].construct(original);
+		});
+	};
+
+	BENCHMARK_ADVANCED("copy assignment")(Catch::Benchmark::Chronometer meter) {
+		string target{"target"};
+		meter.measure([&]() {
+			target = original;
+		});
+	};
+
+	BENCHMARK_ADVANCED("move constructor")(Catch::Benchmark::Chronometer meter) {
+		std::vector<string> sources;
+		sources.reserve(meter.runs());
+		for (int i = 0; i < meter.runs(); i++) {
+			sources.emplace_back("hello world, a string long enough to see the cost of copying");
+		}
+		std::vector<Catch::Benchmark::destructable_object<string>> moved(meter.runs());
+		meter.measure([&](int i) {
+			moved[i].construct(std::move(sources[i]));
+		});
+	};
+
+	BENCHMARK_ADVANCED("construct from temporary")(Catch::Benchmark::Chronometer meter) {
+		std::vector<Catch::Benchmark::destructable_object<string>> values(meter.runs());
+		meter.measure([&](int i) {
+			values[i].construct(string{"hello world"});
+		});
+	};
+}
+#endif
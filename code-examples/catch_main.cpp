@@ -7,18 +7,85 @@
 #ifdef CATCH_ENABLED
 #define CATCH_CONFIG_RUNNER
 #include "catch.hpp"
+#include "perf/cpu_dispatch.h"
+#include "perf/hw_report.h"
+#include "commands.h"
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
 
 namespace unit_catch {
 
+// Catch rejects unknown options: --hw-report=<file> and --isa=<name> are taken here, empty result for a bad --isa
+std::vector<char*> take_runner_options( int argc, char** argv ) {
+  hw_report::apply_command_line(argc, argv);
+  try {
+    cpu_dispatch::apply_command_line(argc, argv);
+  } catch (const std::invalid_argument& error) {
+    std::cerr << error.what() << std::endl;
+    return {};
+  }
+  std::vector<char*> args;
+  for (int i = 0; i < argc; i++) {
+    if (i == 0 || !(hw_report::is_option(argv[i]) || cpu_dispatch::is_option(argv[i]))) {
+      args.push_back(argv[i]);
+    }
+  }
+  return args;
+}
+
+// Catch allows one Session per process and its destructor cleans up the test registry, so commands that run
+// Catch more than once (bench repetitions, bench_asserts) share this one and reset its options every run
+int run_session( std::vector<char*>& args ) {
+  static Catch::Session session;
+  session.useConfigData( Catch::ConfigData{} );
+  return session.run( static_cast<int>(args.size()), args.data() );
+}
+
 int main( int argc, char** argv ) {
   // global setup...
+  std::vector<char*> args = take_runner_options(argc, argv);
+  if (args.empty()) {
+    return 2;
+  }
 
-  int result = Catch::Session().run( argc, argv );
+  int result = run_session( args );
 
   // global clean-up...
 
   return result;
 }
+
+static commands::Registrar registrar{"unit_catch", commands::Kind::test, main, "Catch2 unit tests"};
+}
+
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+namespace bench_catch {
+
+// Runs only the benchmarks ([benchmark] tag) and prints results with the XML reporter, so they can be
+// saved and compared between commits. With any arguments given they are passed to Catch unchanged.
+int main( int argc, char** argv ) {
+  std::vector<char*> args = unit_catch::take_runner_options(argc, argv);
+  if (args.empty()) {
+    return 2;
+  }
+  char spec[] = "[benchmark]";
+  char reporter_option[] = "--reporter";
+  char reporter[] = "xml";
+  if (args.size() <= 1) {
+    args.push_back(spec);
+    args.push_back(reporter_option);
+    args.push_back(reporter);
+  }
+
+  return unit_catch::run_session( args );
 }
+
+static commands::Registrar registrar{"bench_catch", commands::Kind::benchmark, main,
+    "Catch2 [benchmark] test cases",
+    {"[benchmark]", "--benchmark-samples", "10", "--benchmark-warmup-time", "10", "--benchmark-no-analysis"}};
+}
+#endif
 #endif
 
@@ -0,0 +1,250 @@
+/*
+ * commands.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "commands.h"
+#include "perf/json.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <streambuf>
+
+namespace commands {
+
+namespace {
+
+/**
+ * \brief Discards everything, replaces the buffer of std::cout while benchmarks run
+ */
+class NullBuffer: public std::streambuf {
+protected:
+	int overflow(int c) override {
+		return c;
+	}
+};
+
+/**
+ * \brief argv for a command: program name followed by arguments, pointers into arguments
+ */
+std::vector<char*> make_argv(std::vector<std::string>& arguments) {
+	std::vector<char*> argv;
+	for (std::string& argument: arguments) {
+		argv.push_back(&argument[0]);
+	}
+	argv.push_back(nullptr);
+	return argv;
+}
+
+int parse_count(const std::string& option, const std::string& value) {
+	char* end = nullptr;
+	long count = std::strtol(value.c_str(), &end, 10);
+	if (value.empty() || *end != '\0' || count < 0) {
+		throw std::invalid_argument{"invalid number in " + option + value};
+	}
+	return static_cast<int>(count);
+}
+
+struct BenchResult {
+	std::string name;
+	std::vector<std::string> arguments;
+	std::vector<double> seconds;
+	int exit_code = 0;
+};
+
+void write_json(std::ostream& out, const BenchOptions& options, const std::vector<BenchResult>& results) {
+	out<<"{\n\"warmup\": "<<options.warmup<<", \"repetitions\": "<<options.repetitions<<",\n\"benchmarks\": [";
+	for (std::size_t i = 0; i < results.size(); i++) {
+		const BenchResult& result = results[i];
+		out<<(i ? ",\n" : "\n")<<"  {\"name\": ";
+		write_json_string(out, result.name);
+		out<<", \"arguments\": [";
+		for (std::size_t j = 0; j < result.arguments.size(); j++) {
+			out<<(j ? ", " : "");
+			write_json_string(out, result.arguments[j]);
+		}
+		out<<"], \"exit_code\": "<<result.exit_code<<", \"seconds\": [";
+		for (std::size_t j = 0; j < result.seconds.size(); j++) {
+			out<<(j ? ", " : "")<<result.seconds[j];
+		}
+		out<<"]}";
+	}
+	out<<"\n]\n}\n";
+}
+
+}
+
+const char* kind_name(Kind kind) {
+	switch (kind) {
+	case Kind::test: return "test";
+	case Kind::example: return "example";
+	default: return "benchmark";
+	}
+}
+
+BenchOptions parse_bench_options(const std::vector<std::string>& arguments) {
+	BenchOptions options;
+	for (const std::string& argument: arguments) {
+		auto value_of = [&argument](const std::string& option, std::string& value) {
+			if (argument.compare(0, option.size(), option) != 0) {
+				return false;
+			}
+			value = argument.substr(option.size());
+			return true;
+		};
+		std::string value;
+		if (value_of("--warmup=", value)) {
+			options.warmup = parse_count("--warmup=", value);
+		} else if (value_of("--repetitions=", value)) {
+			options.repetitions = parse_count("--repetitions=", value);
+		} else if (value_of("--json=", value)) {
+			options.json = value;
+		} else if (value_of("--filter=", value)) {
+			options.filter = value;
+		} else if (argument == "--verbose") {
+			options.verbose = true;
+		} else {
+			throw std::invalid_argument{"unknown bench option " + argument};
+		}
+	}
+	return options;
+}
+
+Registry& Registry::global() {
+	static Registry registry;
+	return registry;
+}
+
+void Registry::add(Command command) {
+	if (find(command.name)) {
+		throw std::invalid_argument{"command " + command.name + " is registered twice"};
+	}
+	_commands.push_back(std::move(command));
+}
+
+const Command* Registry::find(const std::string& name) const {
+	for (const Command& command: _commands) {
+		if (command.name == name) {
+			return &command;
+		}
+	}
+	return nullptr;
+}
+
+std::vector<Command> Registry::commands() const {
+	std::vector<Command> sorted = _commands;
+	std::sort(sorted.begin(), sorted.end(), [](const Command& a, const Command& b) {
+		return a.kind != b.kind ? a.kind < b.kind : a.name < b.name;
+	});
+	return sorted;
+}
+
+int Registry::run(int argc, char** argv, const std::string& default_command) const {
+	std::string name = argc > 1 ? argv[1] : "";
+	if (name == "list" || name == "help") {
+		std::cout<<"usage: "<<argv[0]<<" [command] [arguments], default command: "<<default_command<<std::endl;
+		std::cout<<"  bench [--warmup=N] [--repetitions=N] [--json=<file>] [--filter=<text>] [--verbose]"<<std::endl;
+		for (const Command& command: commands()) {
+			std::cout<<"  "<<command.name<<" ("<<kind_name(command.kind)<<") - "<<command.description<<std::endl;
+		}
+		return 0;
+	}
+	if (name == "bench") {
+		try {
+			return bench(parse_bench_options(std::vector<std::string>(argv + 2, argv + argc)), std::cout);
+		} catch (const std::invalid_argument& error) {
+			std::cerr<<error.what()<<std::endl;
+			return 2;
+		}
+	}
+
+	const Command* command = find(name);
+	std::vector<char*> arguments(argv, argv + argc);
+	if (command) {
+		arguments.erase(arguments.begin() + 1);
+	} else {
+		command = find(default_command);
+		if (!command) {
+			std::cerr<<"unknown command "<<name<<", and no default command "<<default_command<<std::endl;
+			return 2;
+		}
+	}
+	arguments.push_back(nullptr);
+	return command->entry(static_cast<int>(arguments.size() - 1), arguments.data());
+}
+
+int Registry::bench(const BenchOptions& options, std::ostream& log) const {
+	std::vector<BenchResult> results;
+	NullBuffer null_buffer;
+	bool success = true;
+
+	log<<"benchmark\tmin s\tmedian s\tmean s"<<std::endl;
+	for (const Command& command: commands()) {
+		if (command.kind != Kind::benchmark || command.name.find(options.filter) == std::string::npos) {
+			continue;
+		}
+		BenchResult result;
+		result.name = command.name;
+		result.arguments = command.bench_arguments;
+
+		auto run_once = [&]() {
+			std::vector<std::string> arguments{command.name};
+			arguments.insert(arguments.end(), command.bench_arguments.begin(), command.bench_arguments.end());
+			std::vector<char*> argv = make_argv(arguments);
+			std::streambuf* cout_buffer = options.verbose ? nullptr : std::cout.rdbuf(&null_buffer);
+			auto begin = std::chrono::steady_clock::now();
+			int exit_code = command.entry(static_cast<int>(arguments.size()), argv.data());
+			double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+			if (cout_buffer) {
+				std::cout.rdbuf(cout_buffer);
+			}
+			result.exit_code = exit_code;
+			return seconds;
+		};
+
+		for (int i = 0; i < options.warmup && result.exit_code == 0; i++) {
+			run_once();
+		}
+		for (int i = 0; i < options.repetitions && result.exit_code == 0; i++) {
+			result.seconds.push_back(run_once());
+		}
+
+		log<<result.name;
+		if (result.exit_code != 0) {
+			success = false;
+			log<<"\tfailed with exit code "<<result.exit_code<<std::endl;
+		} else if (!result.seconds.empty()) {
+			std::vector<double> sorted = result.seconds;
+			std::sort(sorted.begin(), sorted.end());
+			double median = sorted.size() % 2 ? sorted[sorted.size() / 2] : (sorted[sorted.size() / 2 - 1] + sorted[sorted.size() / 2]) / 2;
+			double mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+			log<<"\t"<<sorted.front()<<"\t"<<median<<"\t"<<mean<<std::endl;
+		} else {
+			log<<"\tnot measured (0 repetitions)"<<std::endl;
+		}
+		results.push_back(std::move(result));
+	}
+
+	if (!options.json.empty()) {
+		std::ofstream out{options.json};
+		if (!out) {
+			std::cerr<<"bench: can't write "<<options.json<<std::endl;
+			return 1;
+		}
+		write_json(out, options, results);
+	}
+	return success ? 0 : 1;
+}
+
+Registrar::Registrar(const char* name, Kind kind, EntryPoint entry, const char* description, std::vector<std::string> bench_arguments) {
+	Registry::global().add(Command{name, kind, entry, description, std::move(bench_arguments)});
+}
+
+}
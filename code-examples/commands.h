@@ -0,0 +1,107 @@
+/*
+ * commands.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_COMMANDS_H_
+#define CODE_EXAMPLES_COMMANDS_H_
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Named entry points of the program, chosen by the first command line argument
+ *
+ *     code-examples                          runs the default command (unit_doctest)
+ *     code-examples -tc="*list*"             arguments which are not command names go to the default command
+ *     code-examples bench_list_views 1000    runs a command with the rest of the arguments
+ *     code-examples list                     prints all commands
+ *     code-examples bench [options]          runs all benchmarks, see parse_bench_options()
+ *
+ * Every file with a main() registers it with a static Registrar next to its namespace,
+ * so adding an entry point doesn't need changes in main.cpp.
+ */
+namespace commands {
+
+enum class Kind { test, example, benchmark };
+
+const char* kind_name(Kind kind);
+
+using EntryPoint = int (*)(int argc, char** argv);
+
+struct Command {
+	std::string name;
+	Kind kind;
+	EntryPoint entry;
+	std::string description;
+	std::vector<std::string> bench_arguments;	/**< Arguments used by "bench" (smaller sizes than the defaults) */
+};
+
+/**
+ * \brief Options of the "bench" command
+ */
+struct BenchOptions {
+	int warmup = 1;					/**< Untimed runs before the measured ones */
+	int repetitions = 3;			/**< Timed runs */
+	std::string json;				/**< Write results to this file */
+	std::string filter;				/**< Only benchmarks with names containing it */
+	bool verbose = false;			/**< Show output of the benchmarks (hidden by default) */
+};
+
+/**
+ * \brief Parses "--warmup=N", "--repetitions=N", "--json=<file>", "--filter=<text>" and "--verbose"
+ * \throw std::invalid_argument for unknown options and invalid numbers
+ */
+BenchOptions parse_bench_options(const std::vector<std::string>& arguments);
+
+class Registry {
+private:
+	std::vector<Command> _commands;
+public:
+	/**
+	 * \brief Registry filled by Registrar objects during static initialization
+	 */
+	static Registry& global();
+
+	/**
+	 * \throw std::invalid_argument if a command with this name exists
+	 */
+	void add(Command command);
+
+	/**
+	 * \return nullptr if there is no such command
+	 */
+	const Command* find(const std::string& name) const;
+
+	/**
+	 * \brief Commands sorted by kind and name
+	 */
+	std::vector<Command> commands() const;
+
+	/**
+	 * \brief Dispatch by argv[1], see the namespace description
+	 * \return exit code of the command
+	 */
+	int run(int argc, char** argv, const std::string& default_command) const;
+
+	/**
+	 * \brief Run benchmarks with warmup and repetitions, print a summary to log
+	 * \return 0 if all benchmarks returned 0, 1 otherwise
+	 */
+	int bench(const BenchOptions& options, std::ostream& log) const;
+};
+
+/**
+ * \brief Adds a command to Registry::global() when constructed (as a static object)
+ */
+class Registrar {
+public:
+	Registrar(const char* name, Kind kind, EntryPoint entry, const char* description, std::vector<std::string> bench_arguments = {});
+};
+
+}
+
+#endif /* CODE_EXAMPLES_COMMANDS_H_ */
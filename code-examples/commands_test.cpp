@@ -0,0 +1,128 @@
+/*
+ * commands_test.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "commands.h"
+
+#include "doctest.h"
+
+#include <cstdio>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<std::string> received;
+
+int record(int argc, char** argv) {
+	received.assign(argv, argv + argc);
+	return argc;
+}
+
+int noisy(int, char**) {
+	std::cout<<"benchmark output"<<std::endl;
+	return 0;
+}
+
+int failing(int, char**) {
+	return 3;
+}
+
+}
+
+TEST_CASE("[commands] - registry and dispatch") {
+	commands::Registry registry;
+	registry.add({"tests", commands::Kind::test, record, "records arguments", {}});
+	registry.add({"example", commands::Kind::example, record, "records arguments", {}});
+	CHECK_THROWS_AS(registry.add({"tests", commands::Kind::test, record, "", {}}), std::invalid_argument);
+
+	REQUIRE(registry.find("example") != nullptr);
+	CHECK(registry.find("example")->kind == commands::Kind::example);
+	CHECK(registry.find("missing") == nullptr);
+	CHECK(std::string{commands::kind_name(commands::Kind::benchmark)} == "benchmark");
+
+	char program[] = "ex";
+	char name[] = "example";
+	char option[] = "-tc=*x*";
+
+	SUBCASE("command name selects the command and is removed") {
+		char* argv[] = {program, name, option, nullptr};
+		CHECK(registry.run(3, argv, "tests") == 2);
+		CHECK(received == std::vector<std::string>{"ex", "-tc=*x*"});
+	}
+	SUBCASE("other arguments go to the default command") {
+		char* argv[] = {program, option, nullptr};
+		CHECK(registry.run(2, argv, "tests") == 2);
+		CHECK(received == std::vector<std::string>{"ex", "-tc=*x*"});
+	}
+	SUBCASE("no arguments") {
+		char* argv[] = {program, nullptr};
+		CHECK(registry.run(1, argv, "tests") == 1);
+	}
+	SUBCASE("missing default command") {
+		char* argv[] = {program, option, nullptr};
+		std::ostringstream errors;
+		std::streambuf* cerr_buffer = std::cerr.rdbuf(errors.rdbuf());
+		int exit_code = registry.run(2, argv, "missing");
+		std::cerr.rdbuf(cerr_buffer);
+		CHECK(exit_code == 2);
+		CHECK(errors.str() == "unknown command -tc=*x*, and no default command missing\n");
+	}
+}
+
+TEST_CASE("[commands] - bench options") {
+	commands::BenchOptions defaults = commands::parse_bench_options({});
+	CHECK(defaults.warmup == 1);
+	CHECK(defaults.repetitions == 3);
+	CHECK_FALSE(defaults.verbose);
+
+	commands::BenchOptions options = commands::parse_bench_options(
+			{"--warmup=0", "--repetitions=5", "--json=out.json", "--filter=list", "--verbose"});
+	CHECK(options.warmup == 0);
+	CHECK(options.repetitions == 5);
+	CHECK(options.json == "out.json");
+	CHECK(options.filter == "list");
+	CHECK(options.verbose);
+
+	CHECK_THROWS_AS(commands::parse_bench_options({"--repetitions=x"}), std::invalid_argument);
+	CHECK_THROWS_AS(commands::parse_bench_options({"--warmup=-1"}), std::invalid_argument);
+	CHECK_THROWS_AS(commands::parse_bench_options({"--fast"}), std::invalid_argument);
+}
+
+TEST_CASE("[commands] - bench runs benchmarks only") {
+	commands::Registry registry;
+	registry.add({"bench_noisy", commands::Kind::benchmark, noisy, "", {}});
+	registry.add({"bench_args", commands::Kind::benchmark, record, "", {"10", "20"}});
+	registry.add({"tests", commands::Kind::test, failing, "", {}});
+
+	commands::BenchOptions options;
+	options.warmup = 0;
+	options.repetitions = 2;
+	options.json = "commands_test.json";
+	std::ostringstream log;
+	received.clear();
+	CHECK(registry.bench(options, log) == 1); // record() returns argc, a nonzero exit code
+	CHECK(received == std::vector<std::string>{"bench_args", "10", "20"});
+	CHECK(log.str().find("bench_args\tfailed with exit code 3") != std::string::npos);
+	CHECK(log.str().find("bench_noisy\t") != std::string::npos);
+	CHECK(log.str().find("tests") == std::string::npos);
+
+	std::ifstream in{"commands_test.json"};
+	std::stringstream json;
+	json<<in.rdbuf();
+	in.close();
+	std::remove("commands_test.json");
+	CHECK(json.str().find("\"name\": \"bench_args\", \"arguments\": [\"10\", \"20\"], \"exit_code\": 3") != std::string::npos);
+	CHECK(json.str().find("\"repetitions\": 2") != std::string::npos);
+
+	options.filter = "noisy";
+	options.json.clear();
+	CHECK(registry.bench(options, log) == 0);
+}
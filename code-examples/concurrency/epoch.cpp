@@ -0,0 +1,138 @@
+/*
+ * epoch.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "epoch.h"
+
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+/**
+ * \brief Slot of the current thread in the global domain, released when the thread exits
+ */
+struct ThreadSlot {
+	EpochDomain::Slot* slot = nullptr;
+	int depth = 0;	/**< Number of nested ReadGuards */
+
+	~ThreadSlot() {
+		if (slot) {
+			slot->epoch.store(EpochDomain::idle, std::memory_order_release);
+			slot->used.store(false, std::memory_order_release);
+		}
+	}
+};
+
+thread_local ThreadSlot thread_slot;
+
+// delete objects in batches - every collect() scans all slots
+constexpr std::size_t collect_threshold = 64;
+
+}
+
+EpochDomain& EpochDomain::global() {
+	static EpochDomain domain;
+	return domain;
+}
+
+EpochDomain::~EpochDomain() {
+	// called at exit, when no other threads read
+	for (const Retired& item: retired) {
+		item.deleter(item.object);
+	}
+}
+
+EpochDomain::Slot& EpochDomain::claim_slot() {
+	for (Slot& slot: slots) {
+		bool expected = false;
+		if (!slot.used.load(std::memory_order_relaxed) &&
+				slot.used.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+			return slot;
+		}
+	}
+	throw std::runtime_error{"too many threads in epoch read sections"};
+}
+
+EpochDomain::ReadGuard::ReadGuard() {
+	if (thread_slot.depth++ > 0) {
+		return;
+	}
+	EpochDomain& domain = EpochDomain::global();
+	if (!thread_slot.slot) {
+		try {
+			thread_slot.slot = &domain.claim_slot();
+		} catch (...) {
+			thread_slot.depth--;
+			throw;
+		}
+	}
+	thread_slot.slot->epoch.store(domain.global_epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	// pairs with the fence in collect(): either the writer sees this slot, or this reader sees the unlinked data
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+EpochDomain::ReadGuard::~ReadGuard() {
+	if (--thread_slot.depth == 0) {
+		thread_slot.slot->epoch.store(idle, std::memory_order_release);
+	}
+}
+
+unsigned long long EpochDomain::oldest_reader_epoch() {
+	unsigned long long oldest = global_epoch.load(std::memory_order_acquire);
+	for (Slot& slot: slots) {
+		unsigned long long epoch = slot.epoch.load(std::memory_order_acquire);
+		if (epoch != idle && epoch < oldest) {
+			oldest = epoch;
+		}
+	}
+	return oldest;
+}
+
+void EpochDomain::collect(std::unique_lock<std::mutex>&) {
+	global_epoch.fetch_add(1, std::memory_order_seq_cst);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	unsigned long long oldest = oldest_reader_epoch();
+
+	// readers which started after the object was retired (epoch > item.epoch) can't reach it
+	std::size_t kept = 0;
+	for (std::size_t i = 0; i < retired.size(); i++) {
+		if (retired[i].epoch < oldest) {
+			retired[i].deleter(retired[i].object);
+		} else {
+			retired[kept++] = retired[i];
+		}
+	}
+	retired.resize(kept);
+}
+
+void EpochDomain::retire(void* object, void (*deleter)(void*)) {
+	std::unique_lock<std::mutex> lock{retired_mutex};
+	retired.push_back({global_epoch.load(std::memory_order_acquire), object, deleter});
+	if (retired.size() >= collect_threshold) {
+		collect(lock);
+	}
+}
+
+void EpochDomain::synchronize() {
+	unsigned long long target;
+	{
+		std::unique_lock<std::mutex> lock{retired_mutex};
+		target = global_epoch.load(std::memory_order_acquire);
+		collect(lock);
+	}
+	// wait for readers which may still see objects retired up to now
+	while (oldest_reader_epoch() <= target) {
+		std::this_thread::yield();
+	}
+	std::unique_lock<std::mutex> lock{retired_mutex};
+	collect(lock);
+}
+
+std::size_t EpochDomain::pending() const {
+	std::lock_guard<std::mutex> lock{retired_mutex};
+	return retired.size();
+}
@@ -0,0 +1,122 @@
+/*
+ * epoch.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_CONCURRENCY_EPOCH_H_
+#define CODE_EXAMPLES_CONCURRENCY_EPOCH_H_
+
+#include "sharded_counter.h"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+/**
+ * \brief Epoch-based reclamation of memory shared with lock-free readers
+ *
+ * Readers mark the time they access shared data with ReadGuard. Writers unlink an object so that new readers
+ * can't reach it, then retire() it. The object is deleted only when every reader which was active
+ * at the moment of retirement has left its read section.
+ *
+ * Entering and leaving a read section are plain stores to the thread's own slot plus one fence,
+ * no read-modify-write operations and no locks. A thread claims its slot once, on the first ReadGuard,
+ * and frees it when the thread exits.
+ * There is one process-wide domain (EpochDomain::global()) shared by all containers, so that
+ * slots of exiting threads never outlive their domain.
+ */
+class EpochDomain {
+public:
+	static constexpr std::size_t max_threads = 128;	/**< Maximum number of threads reading at the same time */
+	static constexpr unsigned long long idle = 0;	/**< Slot value of a thread outside read sections */
+
+	/**
+	 * \brief Read section: objects reachable inside it are not deleted until it ends
+	 *
+	 * Guards can be nested. A guard must be destroyed by the thread which created it.
+	 */
+	class ReadGuard {
+	public:
+		ReadGuard();
+		~ReadGuard();
+		ReadGuard(const ReadGuard&) = delete;
+		ReadGuard& operator=(const ReadGuard&) = delete;
+	};
+
+	EpochDomain(const EpochDomain&) = delete;
+	EpochDomain& operator=(const EpochDomain&) = delete;
+
+	static EpochDomain& global();
+
+	/**
+	 * \brief Delete object with deleter when no reader can access it any more
+	 *
+	 * object must already be unreachable for new readers. Retired objects are deleted in batches
+	 * by later calls to retire() or by synchronize().
+	 */
+	void retire(void* object, void (*deleter)(void*));
+
+	template<typename T>
+	void retire(T* object) {
+		retire(object, [](void* ptr) { delete static_cast<T*>(ptr); });
+	}
+
+	/**
+	 * \brief Wait until all readers active now have finished and delete everything retired before
+	 *
+	 * Must not be called inside a read section of the calling thread (it would wait for itself).
+	 */
+	void synchronize();
+
+	/**
+	 * \brief Number of retired objects which are not deleted yet
+	 */
+	std::size_t pending() const;
+
+	/**
+	 * \brief Read section state of one thread, padded so that readers don't share cache lines
+	 */
+	struct alignas(cache_line_size) Slot {
+		std::atomic<unsigned long long> epoch{idle};	/**< Epoch seen when the read section started, or idle */
+		std::atomic<bool> used{false};					/**< Claimed by a thread */
+	};
+
+private:
+	struct Retired {
+		unsigned long long epoch;	/**< Global epoch when the object was retired */
+		void* object;
+		void (*deleter)(void*);
+	};
+
+	std::atomic<unsigned long long> global_epoch{1};
+	Slot slots[max_threads];
+
+	mutable std::mutex retired_mutex;
+	std::vector<Retired> retired;
+
+	EpochDomain() = default;
+	~EpochDomain();
+
+	/**
+	 * \brief Claim a free slot for the calling thread
+	 * \throw std::runtime_error if more than max_threads threads use read sections
+	 */
+	Slot& claim_slot();
+
+	/**
+	 * \brief Smallest epoch of active readers, or current global epoch if nobody reads
+	 */
+	unsigned long long oldest_reader_epoch();
+
+	/**
+	 * \brief Advance the epoch and delete retired objects no reader can see, retired_mutex must be held
+	 */
+	void collect(std::unique_lock<std::mutex>& lock);
+
+	friend class ReadGuard;
+};
+
+#endif /* CODE_EXAMPLES_CONCURRENCY_EPOCH_H_ */
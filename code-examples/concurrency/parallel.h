@@ -0,0 +1,128 @@
+/*
+ * parallel.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_CONCURRENCY_PARALLEL_H_
+#define CODE_EXAMPLES_CONCURRENCY_PARALLEL_H_
+
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace parallel_detail {
+
+/**
+ * \brief Grain for ranges of count elements: about 8 chunks per thread, so that stealing can balance the load
+ */
+template<typename Index>
+Index automatic_grain(ThreadPool& pool, Index count) {
+	Index chunks = static_cast<Index>(pool.thread_count() * 8);
+	return std::max(Index{1}, count / chunks);
+}
+
+template<typename Index, typename Function>
+void split_for(ThreadPool& pool, Index begin, Index end, Index grain, const Function& function) {
+	TaskGroup group{pool};
+	// fork the upper halves, keep the lowest chunk for this thread
+	while (end - begin > grain) {
+		Index middle = begin + (end - begin) / 2;
+		group.run([&pool, &function, middle, end, grain]() {
+			split_for(pool, middle, end, grain, function);
+		});
+		end = middle;
+	}
+	for (Index i = begin; i < end; i++) {
+		function(i);
+	}
+	group.wait();
+}
+
+template<typename Index, typename T, typename Chunk, typename Combine>
+T split_reduce(ThreadPool& pool, Index begin, Index end, Index grain, const T& identity, const Chunk& chunk, const Combine& combine) {
+	if (end - begin <= grain) {
+		return chunk(begin, end, identity);
+	}
+	Index middle = begin + (end - begin) / 2;
+	T upper = identity;
+	TaskGroup group{pool};
+	group.run([&]() {
+		upper = split_reduce(pool, middle, end, grain, identity, chunk, combine);
+	});
+	T lower = split_reduce(pool, begin, middle, grain, identity, chunk, combine);
+	group.wait();
+	return combine(lower, upper);
+}
+
+}
+
+/**
+ * \brief Call function(i) for every i in [begin, end) in pool, returns when all calls have finished
+ *
+ * The range is split in halves recursively down to grain indices per task.
+ * \param grain 0 chooses it from the range size and the number of threads
+ * \throw the first exception thrown by function
+ */
+template<typename Index, typename Function>
+void parallel_for(ThreadPool& pool, Index begin, Index end, Index grain, const Function& function) {
+	if (end <= begin) {
+		return;
+	}
+	if (grain <= 0) {
+		grain = parallel_detail::automatic_grain(pool, end - begin);
+	}
+	parallel_detail::split_for(pool, begin, end, grain, function);
+}
+
+/**
+ * \brief Call function(element) for every element of a container with random access iterators (std::vector, arrays)
+ */
+template<typename Container, typename Function>
+void parallel_for_each(ThreadPool& pool, Container& container, std::ptrdiff_t grain, const Function& function) {
+	auto first = std::begin(container);
+	std::ptrdiff_t count = std::distance(first, std::end(container));
+	parallel_for(pool, std::ptrdiff_t{0}, count, grain, [first, &function](std::ptrdiff_t i) {
+		function(first[i]);
+	});
+}
+
+/**
+ * \brief Reduce [begin, end) in pool
+ *
+ * chunk(from, to, identity) reduces a subrange sequentially, combine(lower, upper) joins results of adjacent
+ * subranges in order, so combine must be associative but need not be commutative.
+ * \param grain 0 chooses it from the range size and the number of threads
+ * \throw the first exception thrown by chunk or combine
+ */
+template<typename Index, typename T, typename Chunk, typename Combine>
+T parallel_reduce(ThreadPool& pool, Index begin, Index end, Index grain, T identity, Chunk chunk, Combine combine) {
+	if (end <= begin) {
+		return identity;
+	}
+	if (grain <= 0) {
+		grain = parallel_detail::automatic_grain(pool, end - begin);
+	}
+	return parallel_detail::split_reduce(pool, begin, end, grain, identity, chunk, combine);
+}
+
+/**
+ * \brief Reduce the elements of a container with random access iterators: combine(...combine(identity, e0)..., en)
+ */
+template<typename Container, typename T, typename Combine>
+T parallel_reduce(ThreadPool& pool, const Container& container, std::ptrdiff_t grain, T identity, Combine combine) {
+	auto first = std::begin(container);
+	std::ptrdiff_t count = std::distance(first, std::end(container));
+	return parallel_reduce(pool, std::ptrdiff_t{0}, count, grain, identity,
+		[first, &combine](std::ptrdiff_t from, std::ptrdiff_t to, T result) {
+			for (std::ptrdiff_t i = from; i < to; i++) {
+				result = combine(result, first[i]);
+			}
+			return result;
+		},
+		combine);
+}
+
+#endif /* CODE_EXAMPLES_CONCURRENCY_PARALLEL_H_ */
@@ -0,0 +1,115 @@
+/*
+ * sharded_counter.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_CONCURRENCY_SHARDED_COUNTER_H_
+#define CODE_EXAMPLES_CONCURRENCY_SHARDED_COUNTER_H_
+
+#include <atomic>
+#include <cstddef>
+
+/**
+ * \brief Assumed size of a cache line in bytes
+ *
+ * Used to pad data written by different threads, so that they don't share (and fight over) the same line.
+ */
+constexpr std::size_t cache_line_size = 64;
+
+/**
+ * \brief Index of the shard used by the calling thread
+ *
+ * Each thread gets its own number (round robin) the first time it calls this function.
+ * \param shard_count number of shards, must be > 0
+ * \return value in range [0, shard_count)
+ */
+inline std::size_t current_thread_shard(std::size_t shard_count) {
+	static std::atomic<std::size_t> next_thread{0};
+	thread_local std::size_t thread_number = next_thread.fetch_add(1, std::memory_order_relaxed);
+	return thread_number % shard_count;
+}
+
+/**
+ * \brief Process-wide counter split into per-thread shards
+ *
+ * A replacement for a global `int` (or `std::atomic<int>`) counter incremented by many threads.
+ * Each thread increments its own shard (padded to a cache line) with a relaxed atomic operation,
+ * so increments never race and don't cause false sharing.
+ * Reading sums all shards, so it is more expensive than increment and, while other threads are still
+ * counting, returns a value which was correct at some moment during the call.
+ *
+ * The constructor is constexpr, so a global ShardedCounter is initialized before any dynamic initialization
+ * (safe to use from constructors of other globals).
+ *
+ * \tparam Shards number of shards, should be >= number of threads which count at the same time
+ */
+template<std::size_t Shards = 32>
+class ShardedCounter {
+private:
+	struct alignas(cache_line_size) Shard {
+		std::atomic<long long> value{0};
+	};
+	Shard shards[Shards];
+public:
+	static_assert(Shards > 0, "ShardedCounter needs at least one shard");
+
+	constexpr ShardedCounter() = default;
+	ShardedCounter(const ShardedCounter&) = delete;
+	ShardedCounter& operator=(const ShardedCounter&) = delete;
+
+	/**
+	 * \brief Add delta to the shard of the calling thread
+	 *
+	 * Complexity is O(1), never blocks.
+	 * \param delta value to add, can be negative
+	 */
+	void add(long long delta = 1) {
+		shards[current_thread_shard(Shards)].value.fetch_add(delta, std::memory_order_relaxed);
+	}
+
+	ShardedCounter& operator++() {
+		add(1);
+		return *this;
+	}
+
+	ShardedCounter& operator+=(long long delta) {
+		add(delta);
+		return *this;
+	}
+
+	/**
+	 * \brief Aggregated value of all shards
+	 *
+	 * Complexity is O(Shards)
+	 */
+	long long load() const {
+		long long result = 0;
+		for (const Shard& shard: shards) {
+			result += shard.value.load(std::memory_order_relaxed);
+		}
+		return result;
+	}
+
+	operator long long() const {
+		return load();
+	}
+
+	/**
+	 * \brief Set all shards to zero
+	 *
+	 * Increments made by other threads at the same time can be lost.
+	 */
+	void reset() {
+		for (Shard& shard: shards) {
+			shard.value.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	static constexpr std::size_t shard_count() {
+		return Shards;
+	}
+};
+
+#endif /* CODE_EXAMPLES_CONCURRENCY_SHARDED_COUNTER_H_ */
@@ -0,0 +1,94 @@
+/*
+ * sharded_counter_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "sharded_counter.h"
+#include "../commands.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace bench_sharded_counter {
+
+std::atomic<int> global_counter{0};
+ShardedCounter<> sharded_counter;
+
+/**
+ * \brief Run increment in thread_count threads, iterations times in each
+ * \return nanoseconds per increment (wall time divided by the total number of increments)
+ */
+template<typename Increment>
+double measure(int thread_count, long iterations, Increment increment) {
+	std::atomic<bool> start{false};
+	std::vector<std::thread> threads;
+	for (int i = 0; i < thread_count; i++) {
+		threads.emplace_back([&]() {
+			while (!start.load(std::memory_order_acquire)) {
+				std::this_thread::yield();
+			}
+			for (long j = 0; j < iterations; j++) {
+				increment();
+			}
+		});
+	}
+	auto begin = std::chrono::steady_clock::now();
+	start.store(true, std::memory_order_release);
+	for (auto& thread: threads) {
+		thread.join();
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - begin;
+	return elapsed.count() / (double(thread_count) * iterations);
+}
+
+/**
+ * \brief Prints the times of both counters with this many threads
+ * \return false if the counters disagree
+ */
+bool measure_row(int threads, long iterations) {
+	global_counter = 0;
+	sharded_counter.reset();
+	double atomic_ns = measure(threads, iterations, []() {
+		global_counter.fetch_add(1, std::memory_order_relaxed);
+	});
+	double sharded_ns = measure(threads, iterations, []() {
+		sharded_counter.add();
+	});
+	std::cout<<threads<<"\t"<<atomic_ns<<"\t"<<sharded_ns<<std::endl;
+
+	if (global_counter != sharded_counter.load()) {
+		std::cerr<<"counters differ: "<<global_counter<<" != "<<sharded_counter.load()<<std::endl;
+		return false;
+	}
+	return true;
+}
+
+// usage: bench_sharded_counter [iterations per thread] [max threads]
+int main(int argc, char** argv) {
+	long iterations = argc > 1 ? std::atol(argv[1]) : 10000000;
+	int max_threads = argc > 2 ? std::atoi(argv[2]) : 0;
+	if (max_threads <= 0) {
+		max_threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	std::cout<<"threads\tatomic<int> ns/op\tShardedCounter ns/op"<<std::endl;
+	// powers of two below max_threads, then max_threads itself
+	for (int threads = 1; threads < max_threads; threads *= 2) {
+		if (!measure_row(threads, iterations)) {
+			return 1;
+		}
+	}
+	return measure_row(max_threads, iterations) ? 0 : 1;
+}
+
+static commands::Registrar registrar{"bench_sharded_counter", commands::Kind::benchmark, main,
+		"atomic counter vs sharded counter, threads scaling", {"200000", "2"}};
+
+}
@@ -0,0 +1,54 @@
+/*
+ * sharded_counter_test.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "sharded_counter.h"
+
+#include "../doctest.h"
+
+#include <thread>
+#include <vector>
+
+TEST_CASE("[sharded counter] - single thread") {
+	ShardedCounter<4> counter;
+	CHECK(counter.load() == 0);
+
+	counter.add();
+	++counter;
+	counter += 10;
+	CHECK(counter.load() == 12);
+
+	counter.add(-2);
+	CHECK(counter == 10);
+
+	counter.reset();
+	CHECK(counter.load() == 0);
+}
+
+TEST_CASE("[sharded counter] - shards are padded to cache lines") {
+	CHECK(sizeof(ShardedCounter<4>) == 4*cache_line_size);
+	CHECK(alignof(ShardedCounter<4>) == cache_line_size);
+	CHECK(ShardedCounter<4>::shard_count() == 4);
+}
+
+TEST_CASE("[sharded counter] - many threads") {
+	ShardedCounter<> counter;
+	const int thread_count = 8;
+	const int increments = 10000;
+
+	std::vector<std::thread> threads;
+	for (int i = 0; i < thread_count; i++) {
+		threads.emplace_back([&counter]() {
+			for (int j = 0; j < increments; j++) {
+				++counter;
+			}
+		});
+	}
+	for (auto& thread: threads) {
+		thread.join();
+	}
+	CHECK(counter.load() == thread_count*increments);
+}
@@ -0,0 +1,64 @@
+/*
+ * spinlock.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_CONCURRENCY_SPINLOCK_H_
+#define CODE_EXAMPLES_CONCURRENCY_SPINLOCK_H_
+
+#include <atomic>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+/**
+ * \brief Hint to the CPU that the thread is spinning (pause instruction on x86)
+ */
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+	_mm_pause();
+#endif
+}
+
+/**
+ * \brief Small test-and-test-and-set lock for very short critical sections
+ *
+ * One byte, so it can be put into every node of a container. Waiting threads spin on a plain load
+ * (no cache line ping-pong), and yield after a while in case the owner was preempted.
+ * Meets the Lockable requirements, so it works with std::lock_guard and std::unique_lock.
+ */
+class Spinlock {
+private:
+	std::atomic<bool> locked{false};
+public:
+	constexpr Spinlock() = default;
+	Spinlock(const Spinlock&) = delete;
+	Spinlock& operator=(const Spinlock&) = delete;
+
+	void lock() {
+		int spins = 0;
+		while (locked.exchange(true, std::memory_order_acquire)) {
+			while (locked.load(std::memory_order_relaxed)) {
+				if (++spins < 64) {
+					cpu_relax();
+				} else {
+					std::this_thread::yield();
+				}
+			}
+		}
+	}
+
+	bool try_lock() {
+		return !locked.load(std::memory_order_relaxed) && !locked.exchange(true, std::memory_order_acquire);
+	}
+
+	void unlock() {
+		locked.store(false, std::memory_order_release);
+	}
+};
+
+#endif /* CODE_EXAMPLES_CONCURRENCY_SPINLOCK_H_ */
@@ -0,0 +1,200 @@
+/*
+ * thread_pool.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+
+namespace {
+
+// worker identity of the calling thread
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local int current_index = -1;
+
+// attempts to find work before a worker goes to sleep
+constexpr int idle_spins = 64;
+
+// sleeping workers also wake up on their own: pushes to deques don't take sleep_mutex, so a notification can be missed
+constexpr std::chrono::milliseconds sleep_timeout{1};
+
+/**
+ * \brief Cheap per-thread random numbers for choosing steal victims
+ */
+unsigned next_random() {
+	thread_local unsigned state = std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1;
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+}
+
+ThreadPool::ThreadPool(std::size_t threads, Scheduling scheduling): _scheduling{scheduling} {
+	if (threads == 0) {
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	for (std::size_t i = 0; i < threads; i++) {
+		workers.push_back(std::make_unique<Worker>());
+	}
+	// start threads only when all deques exist - they steal from each other
+	for (std::size_t i = 0; i < threads; i++) {
+		workers[i]->thread = std::thread{&ThreadPool::worker_loop, this, static_cast<int>(i)};
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock{sleep_mutex};
+		stopping.store(true, std::memory_order_relaxed);
+	}
+	wake_up.notify_all();
+	for (auto& worker: workers) {
+		worker->thread.join();
+	}
+	for (auto& worker: workers) {
+		while (auto task = worker->deque.take()) {
+			delete *task;
+		}
+	}
+	for (Task* task: queue) {
+		delete task;
+	}
+}
+
+int ThreadPool::current_worker() const {
+	return current_pool == this ? current_index : -1;
+}
+
+void ThreadPool::submit(Task* task) {
+	int worker = current_worker();
+	if (_scheduling == Scheduling::work_stealing && worker >= 0) {
+		workers[worker]->deque.push(task);
+	} else {
+		std::lock_guard<std::mutex> lock{queue_mutex};
+		queue.push_back(task);
+	}
+	if (sleeping.load(std::memory_order_relaxed) > 0) {
+		wake_up.notify_one();
+	}
+}
+
+ThreadPool::Task* ThreadPool::find_task(int worker) {
+	if (worker >= 0 && _scheduling == Scheduling::work_stealing) {
+		if (auto task = workers[worker]->deque.take()) {
+			return *task;
+		}
+	}
+	{
+		std::lock_guard<std::mutex> lock{queue_mutex};
+		if (!queue.empty()) {
+			Task* task = queue.front();
+			queue.pop_front();
+			return task;
+		}
+	}
+	if (_scheduling == Scheduling::work_stealing) {
+		std::size_t count = workers.size();
+		std::size_t first = next_random() % count;
+		for (std::size_t i = 0; i < count; i++) {
+			std::size_t victim = (first + i) % count;
+			if (static_cast<int>(victim) == worker) {
+				continue;
+			}
+			if (auto task = workers[victim]->deque.steal()) {
+				return *task;
+			}
+		}
+	}
+	return nullptr;
+}
+
+void ThreadPool::execute(Task* task) {
+	TaskGroup* group = task->group;
+	std::exception_ptr error;
+	try {
+		task->run();
+	} catch (...) {
+		error = std::current_exception();
+	}
+	delete task;
+	if (group) {
+		group->finished(error);
+	}
+}
+
+bool ThreadPool::run_one() {
+	Task* task = find_task(current_worker());
+	if (!task) {
+		return false;
+	}
+	execute(task);
+	return true;
+}
+
+void ThreadPool::worker_loop(int worker) {
+	current_pool = this;
+	current_index = worker;
+	int idle = 0;
+	while (!stopping.load(std::memory_order_relaxed)) {
+		if (Task* task = find_task(worker)) {
+			execute(task);
+			idle = 0;
+			continue;
+		}
+		if (++idle < idle_spins) {
+			std::this_thread::yield();
+			continue;
+		}
+		std::unique_lock<std::mutex> lock{sleep_mutex};
+		if (stopping.load(std::memory_order_relaxed)) {
+			break;
+		}
+		sleeping.fetch_add(1, std::memory_order_relaxed);
+		wake_up.wait_for(lock, sleep_timeout);
+		sleeping.fetch_sub(1, std::memory_order_relaxed);
+		idle = 0;
+	}
+	current_pool = nullptr;
+	current_index = -1;
+}
+
+TaskGroup::~TaskGroup() {
+	wait_all();
+}
+
+void TaskGroup::finished(std::exception_ptr task_error) {
+	if (task_error) {
+		std::lock_guard<std::mutex> lock{error_mutex};
+		if (!error) {
+			error = task_error;
+		}
+	}
+	pending.fetch_sub(1, std::memory_order_release);
+}
+
+void TaskGroup::wait_all() {
+	while (pending.load(std::memory_order_acquire) > 0) {
+		if (!pool.run_one()) {
+			std::this_thread::yield();
+		}
+	}
+}
+
+void TaskGroup::wait() {
+	wait_all();
+	std::exception_ptr to_throw;
+	{
+		std::lock_guard<std::mutex> lock{error_mutex};
+		std::swap(to_throw, error);
+	}
+	if (to_throw) {
+		std::rethrow_exception(to_throw);
+	}
+}
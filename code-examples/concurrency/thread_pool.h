@@ -0,0 +1,165 @@
+/*
+ * thread_pool.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_CONCURRENCY_THREAD_POOL_H_
+#define CODE_EXAMPLES_CONCURRENCY_THREAD_POOL_H_
+
+#include "work_stealing_deque.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class TaskGroup;
+
+/**
+ * \brief Fixed set of worker threads for fork-join parallelism
+ *
+ * With Scheduling::work_stealing every worker has its own WorkStealingDeque: tasks spawned by a worker go
+ * to its deque and are run LIFO by that worker, idle workers steal the oldest (usually the largest) tasks
+ * of the others. Tasks submitted by other threads go to a shared injection queue.
+ * Scheduling::shared_queue puts every task into the injection queue - the baseline for benchmarks.
+ *
+ * Threads waiting for a TaskGroup don't block, they run pending tasks meanwhile.
+ */
+class ThreadPool {
+public:
+	enum class Scheduling { work_stealing, shared_queue };
+
+	/**
+	 * \brief Unit of work, deleted by the pool after run()
+	 */
+	class Task {
+	public:
+		virtual ~Task() = default;
+		virtual void run() = 0;
+	private:
+		TaskGroup* group = nullptr;
+		friend class ThreadPool;
+		friend class TaskGroup;
+	};
+
+	/**
+	 * \param threads number of workers, 0 means std::thread::hardware_concurrency()
+	 */
+	explicit ThreadPool(std::size_t threads = 0, Scheduling scheduling = Scheduling::work_stealing);
+
+	/**
+	 * \brief Stops and joins the workers, tasks which have not started are deleted without running
+	 */
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/**
+	 * \brief Run one pending task on the calling thread
+	 * \return false if no task was found
+	 */
+	bool run_one();
+
+	std::size_t thread_count() const {
+		return workers.size();
+	}
+
+	Scheduling scheduling() const {
+		return _scheduling;
+	}
+
+private:
+	struct Worker {
+		WorkStealingDeque<Task*> deque;
+		std::thread thread;
+	};
+
+	const Scheduling _scheduling;
+	std::vector<std::unique_ptr<Worker>> workers;
+
+	std::mutex queue_mutex;
+	std::deque<Task*> queue;				/**< Injection queue (all tasks with Scheduling::shared_queue) */
+
+	std::mutex sleep_mutex;
+	std::condition_variable wake_up;
+	std::atomic<int> sleeping{0};
+	std::atomic<bool> stopping{false};
+
+	/**
+	 * \brief Queue task, takes ownership
+	 */
+	void submit(Task* task);
+
+	/**
+	 * \brief Index of the calling thread in workers, or -1 if it is not a worker of this pool
+	 */
+	int current_worker() const;
+
+	Task* find_task(int worker);
+	void execute(Task* task);
+	void worker_loop(int worker);
+
+	friend class TaskGroup;
+};
+
+/**
+ * \brief Set of tasks run in a ThreadPool which can be waited for
+ *
+ * The first exception thrown by a task is rethrown by wait(), the other tasks still run.
+ * The destructor waits as well (and drops the exception), so tasks may capture local variables by reference.
+ */
+class TaskGroup {
+public:
+	explicit TaskGroup(ThreadPool& pool): pool{pool} {}
+
+	~TaskGroup();
+
+	TaskGroup(const TaskGroup&) = delete;
+	TaskGroup& operator=(const TaskGroup&) = delete;
+
+	/**
+	 * \brief Run function() in the pool
+	 */
+	template<typename Function>
+	void run(Function&& function) {
+		struct FunctionTask: ThreadPool::Task {
+			typename std::decay<Function>::type function;
+			explicit FunctionTask(Function&& function): function{std::forward<Function>(function)} {}
+			void run() override {
+				function();
+			}
+		};
+		auto task = new FunctionTask{std::forward<Function>(function)};
+		task->group = this;
+		pending.fetch_add(1, std::memory_order_relaxed);
+		pool.submit(task);
+	}
+
+	/**
+	 * \brief Wait until all tasks have finished, running pending tasks of the pool meanwhile
+	 * \throw the first exception thrown by a task
+	 */
+	void wait();
+
+private:
+	ThreadPool& pool;
+	std::atomic<long> pending{0};
+	std::mutex error_mutex;
+	std::exception_ptr error;
+
+	void finished(std::exception_ptr task_error);
+	void wait_all();
+
+	friend class ThreadPool;
+};
+
+#endif /* CODE_EXAMPLES_CONCURRENCY_THREAD_POOL_H_ */
@@ -0,0 +1,107 @@
+/*
+ * thread_pool_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "parallel.h"
+#include "thread_pool.h"
+#include "../commands.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace bench_work_stealing {
+
+const int fib_cutoff = 12;
+
+long long serial_fib(int n) {
+	return n < 2 ? n : serial_fib(n - 1) + serial_fib(n - 2);
+}
+
+/**
+ * \brief Fork-join fib: many small tasks, most of them spawned by workers
+ */
+long long fib(ThreadPool& pool, int n) {
+	if (n < fib_cutoff) {
+		return serial_fib(n);
+	}
+	long long a = 0;
+	TaskGroup group{pool};
+	group.run([&]() {
+		a = fib(pool, n - 1);
+	});
+	long long b = fib(pool, n - 2);
+	group.wait();
+	return a + b;
+}
+
+template<typename Function>
+double seconds(Function function) {
+	auto begin = std::chrono::steady_clock::now();
+	function();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+// usage: bench_work_stealing [fib n] [array size] [reduction grain] [max threads]
+int main(int argc, char** argv) {
+	int n = argc > 1 ? std::atoi(argv[1]) : 32;
+	long size = argc > 2 ? std::atol(argv[2]) : 50000000;
+	long grain = argc > 3 ? std::atol(argv[3]) : 10000;
+	int max_threads = argc > 4 ? std::atoi(argv[4]) : 0;
+	if (max_threads <= 0) {
+		max_threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	std::vector<double> values(size);
+	for (long i = 0; i < size; i++) {
+		values[i] = 1.0 / (i + 1);
+	}
+	auto add = [](double a, double b) { return a + b; };
+
+	long long expected_fib = 0;
+	double serial_fib_time = seconds([&]() { expected_fib = serial_fib(n); });
+	double expected_sum = 0;
+	double serial_sum_time = seconds([&]() {
+		for (double value: values) {
+			expected_sum += value;
+		}
+	});
+	std::cout<<"serial: fib("<<n<<") "<<serial_fib_time<<" s, sum of "<<size<<" doubles "<<serial_sum_time<<" s"<<std::endl;
+
+	std::cout<<"threads\tfib shared queue s\tfib work stealing s\tsum shared queue s\tsum work stealing s"<<std::endl;
+	for (int threads = 1; threads <= max_threads; threads *= 2) {
+		std::cout<<threads;
+		double times[2][2];
+		int column = 0;
+		for (auto scheduling: {ThreadPool::Scheduling::shared_queue, ThreadPool::Scheduling::work_stealing}) {
+			ThreadPool pool{static_cast<std::size_t>(threads), scheduling};
+			long long result = 0;
+			times[0][column] = seconds([&]() { result = fib(pool, n); });
+			if (result != expected_fib) {
+				std::cerr<<"wrong fib: "<<result<<std::endl;
+				return 1;
+			}
+			double sum = 0;
+			times[1][column] = seconds([&]() { sum = parallel_reduce(pool, values, grain, 0.0, add); });
+			if (std::abs(sum - expected_sum) > 1e-6) {
+				std::cerr<<"wrong sum: "<<sum<<std::endl;
+				return 1;
+			}
+			column++;
+		}
+		std::cout<<"\t"<<times[0][0]<<"\t"<<times[0][1]<<"\t"<<times[1][0]<<"\t"<<times[1][1]<<std::endl;
+	}
+	return 0;
+}
+
+static commands::Registrar registrar{"bench_work_stealing", commands::Kind::benchmark, main,
+		"fib and parallel_reduce, work stealing vs shared queue", {"20", "2000000", "10000", "2"}};
+
+}
@@ -0,0 +1,203 @@
+/*
+ * thread_pool_test.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "parallel.h"
+#include "thread_pool.h"
+#include "work_stealing_deque.h"
+
+#include "../doctest.h"
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace test_thread_pool {
+
+long long fib(ThreadPool& pool, int n) {
+	if (n < 10) {
+		return n < 2 ? n : fib(pool, n - 1) + fib(pool, n - 2);
+	}
+	long long a = 0;
+	TaskGroup group{pool};
+	group.run([&]() {
+		a = fib(pool, n - 1);
+	});
+	long long b = fib(pool, n - 2);
+	group.wait();
+	return a + b;
+}
+
+}
+
+using namespace test_thread_pool;
+
+TEST_CASE("[work stealing deque] - owner takes LIFO, thieves steal FIFO") {
+	WorkStealingDeque<int> deque{2};
+	CHECK(deque.empty());
+	CHECK_FALSE(deque.take());
+	CHECK_FALSE(deque.steal());
+
+	for (int i = 0; i < 10; i++) {
+		deque.push(i);
+	}
+	CHECK(deque.size() == 10);
+	CHECK(deque.capacity() == 16); // grown from 2
+
+	CHECK(*deque.take() == 9);
+	CHECK(*deque.steal() == 0);
+	CHECK(*deque.steal() == 1);
+	CHECK(*deque.take() == 8);
+	CHECK(deque.size() == 6);
+
+	for (int i = 2; i < 8; i++) {
+		CHECK(*deque.steal() == i);
+	}
+	CHECK(deque.empty());
+	CHECK_FALSE(deque.take());
+
+	// indices keep growing, items wrap around the circular array
+	for (int round = 0; round < 100; round++) {
+		deque.push(round);
+		deque.push(round + 1);
+		CHECK(*deque.steal() == round);
+		CHECK(*deque.take() == round + 1);
+	}
+	CHECK(deque.capacity() == 16);
+}
+
+TEST_CASE("[work stealing deque] - every item is taken exactly once") {
+	const int items = 100000;
+	const int thieves = 3;
+	WorkStealingDeque<int> deque;
+	std::vector<std::atomic<int>> seen(items);
+	std::atomic<bool> done{false};
+	std::atomic<int> stolen{0};
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < thieves; t++) {
+		threads.emplace_back([&]() {
+			while (!done.load(std::memory_order_acquire) || !deque.empty()) {
+				if (auto item = deque.steal()) {
+					seen[*item]++;
+					stolen++;
+				}
+			}
+		});
+	}
+	int taken = 0;
+	for (int i = 0; i < items; i++) {
+		deque.push(i);
+		if (i % 3 == 0) { // the owner takes some items back, racing with thieves for the last one
+			if (auto item = deque.take()) {
+				seen[*item]++;
+				taken++;
+			}
+		}
+	}
+	while (auto item = deque.take()) {
+		seen[*item]++;
+		taken++;
+	}
+	done.store(true, std::memory_order_release);
+	for (auto& thread: threads) {
+		thread.join();
+	}
+
+	CHECK(taken + stolen == items);
+	int wrong = 0;
+	for (auto& count: seen) {
+		if (count != 1) {
+			wrong++;
+		}
+	}
+	CHECK(wrong == 0);
+}
+
+TEST_CASE("[thread pool] - fork-join") {
+	for (auto scheduling: {ThreadPool::Scheduling::work_stealing, ThreadPool::Scheduling::shared_queue}) {
+		ThreadPool pool{4, scheduling};
+		CHECK(pool.thread_count() == 4);
+		CHECK(fib(pool, 25) == 75025);
+	}
+}
+
+TEST_CASE("[thread pool] - task groups") {
+	ThreadPool pool{3};
+
+	SUBCASE("wait for all tasks") {
+		std::atomic<int> count{0};
+		TaskGroup group{pool};
+		for (int i = 0; i < 1000; i++) {
+			group.run([&count]() {
+				count++;
+			});
+		}
+		group.wait();
+		CHECK(count == 1000);
+	}
+
+	SUBCASE("the first exception is rethrown, other tasks still run") {
+		std::atomic<int> count{0};
+		TaskGroup group{pool};
+		for (int i = 0; i < 100; i++) {
+			group.run([&count, i]() {
+				count++;
+				if (i == 50) {
+					throw std::runtime_error{"task failed"};
+				}
+			});
+		}
+		CHECK_THROWS_AS(group.wait(), std::runtime_error);
+		CHECK(count == 100);
+		group.wait(); // the exception is reported once
+	}
+
+	SUBCASE("a single thread pool runs nested waits") {
+		ThreadPool single{1};
+		CHECK(fib(single, 20) == 6765);
+	}
+}
+
+TEST_CASE("[thread pool] - parallel for and reduce") {
+	ThreadPool pool{4};
+	std::vector<long long> values(100000);
+
+	parallel_for(pool, std::size_t{0}, values.size(), std::size_t{0}, [&values](std::size_t i) {
+		values[i] = i;
+	});
+	CHECK(std::accumulate(values.begin(), values.end(), 0LL) == 99999LL * 100000 / 2);
+
+	parallel_for_each(pool, values, 1000, [](long long& value) {
+		value *= 2;
+	});
+	CHECK(values[12345] == 24690);
+
+	long long sum = parallel_reduce(pool, values, 0, 0LL, [](long long a, long long b) { return a + b; });
+	CHECK(sum == 99999LL * 100000);
+
+	// combine is applied in order: concatenation is not commutative
+	std::string letters = parallel_reduce(pool, 0, 26, 1, std::string{},
+		[](int from, int to, std::string result) {
+			for (int i = from; i < to; i++) {
+				result += static_cast<char>('a' + i);
+			}
+			return result;
+		},
+		[](const std::string& lower, const std::string& upper) { return lower + upper; });
+	CHECK(letters == "abcdefghijklmnopqrstuvwxyz");
+
+	CHECK(parallel_reduce(pool, 5, 5, 1, 42, [](int, int, int r) { return r; }, [](int a, int b) { return a + b; }) == 42);
+
+	CHECK_THROWS_AS(parallel_for(pool, 0, 100, 1, [](int i) {
+		if (i == 77) {
+			throw std::out_of_range{"77"};
+		}
+	}), std::out_of_range);
+}
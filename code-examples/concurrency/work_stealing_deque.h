@@ -0,0 +1,176 @@
+/*
+ * work_stealing_deque.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_CONCURRENCY_WORK_STEALING_DEQUE_H_
+#define CODE_EXAMPLES_CONCURRENCY_WORK_STEALING_DEQUE_H_
+
+#include "sharded_counter.h"
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+
+/**
+ * \brief Chase-Lev work-stealing deque
+ *
+ * The owner thread pushes and takes at the bottom (LIFO, O(1), no read-modify-write except when one item is left),
+ * any other thread steals from the top (FIFO, lock-free, one compare-exchange).
+ * Memory orders follow "Correct and Efficient Work-Stealing for Weak Memory Models" (Le, Pop, Cohen, Zappa Nardelli, 2013).
+ *
+ * Items are stored in a circular array which doubles when full. A thief can still read the array it loaded
+ * before the growth, so old arrays are not deleted: like ListNode, each array points to the previous one,
+ * and the whole chain is deleted with the deque (it is at most as large as the current array).
+ *
+ * \tparam T trivially copyable item, usually a pointer to a task
+ */
+template<typename T>
+class WorkStealingDeque {
+	static_assert(std::is_trivially_copyable<T>::value, "items are copied with atomic loads and stores");
+private:
+	struct CircularArray {
+		std::size_t capacity;			/**< Power of two */
+		std::atomic<T>* items;
+		CircularArray* previous;		/**< Smaller array replaced by this one, kept for thieves still reading it */
+
+		CircularArray(std::size_t capacity, CircularArray* previous): capacity{capacity}, items{new std::atomic<T>[capacity]}, previous{previous} {}
+
+		~CircularArray() {
+			delete[] items;
+		}
+
+		T get(long long index) const {
+			return items[index & (capacity - 1)].load(std::memory_order_relaxed);
+		}
+
+		void put(long long index, T value) {
+			items[index & (capacity - 1)].store(value, std::memory_order_relaxed);
+		}
+	};
+
+	// top is written by thieves, bottom only by the owner - keep them on different cache lines
+	alignas(cache_line_size) std::atomic<long long> top{0};
+	alignas(cache_line_size) std::atomic<long long> bottom{0};
+	alignas(cache_line_size) std::atomic<CircularArray*> array;
+
+	CircularArray* grow(CircularArray* old, long long bottom_index, long long top_index) {
+		auto bigger = new CircularArray{old->capacity * 2, old};
+		for (long long i = top_index; i < bottom_index; i++) {
+			bigger->put(i, old->get(i));
+		}
+		array.store(bigger, std::memory_order_release);
+		return bigger;
+	}
+public:
+	/**
+	 * \param capacity initial capacity, rounded up to a power of two
+	 */
+	explicit WorkStealingDeque(std::size_t capacity = 64) {
+		std::size_t rounded = 1;
+		while (rounded < capacity) {
+			rounded *= 2;
+		}
+		array.store(new CircularArray{rounded, nullptr}, std::memory_order_relaxed);
+	}
+
+	WorkStealingDeque(const WorkStealingDeque&) = delete;
+	WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+	~WorkStealingDeque() {
+		CircularArray* current = array.load(std::memory_order_relaxed);
+		while (current) {
+			CircularArray* to_delete = current;
+			current = current->previous;
+			delete to_delete;
+		}
+	}
+
+	/**
+	 * \brief Add item at the bottom, only the owner thread may call it
+	 *
+	 * Complexity is amortized O(1)
+	 */
+	void push(T item) {
+		long long b = bottom.load(std::memory_order_relaxed);
+		long long t = top.load(std::memory_order_acquire);
+		CircularArray* a = array.load(std::memory_order_relaxed);
+		if (b - t > static_cast<long long>(a->capacity) - 1) {
+			a = grow(a, b, t);
+		}
+		a->put(b, item);
+		// release store instead of the paper's release fence and relaxed store: same cost, and visible to ThreadSanitizer
+		bottom.store(b + 1, std::memory_order_release);
+	}
+
+	/**
+	 * \brief Remove the last pushed item, only the owner thread may call it
+	 *
+	 * \return empty if there are no items (or a thief took the last one)
+	 */
+	std::optional<T> take() {
+		long long b = bottom.load(std::memory_order_relaxed) - 1;
+		CircularArray* a = array.load(std::memory_order_relaxed);
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		long long t = top.load(std::memory_order_relaxed);
+
+		if (t > b) { // empty
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return std::nullopt;
+		}
+		std::optional<T> item = a->get(b);
+		if (t == b) { // the last item - race with thieves
+			if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+				item = std::nullopt;
+			}
+			bottom.store(b + 1, std::memory_order_relaxed);
+		}
+		return item;
+	}
+
+	/**
+	 * \brief Remove the oldest item, any thread may call it
+	 *
+	 * \return empty if there are no items or another thread won the race for the top item (worth retrying elsewhere)
+	 */
+	std::optional<T> steal() {
+		long long t = top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		long long b = bottom.load(std::memory_order_acquire);
+		if (t >= b) {
+			return std::nullopt;
+		}
+		CircularArray* a = array.load(std::memory_order_acquire);
+		T item = a->get(t);
+		if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+			return std::nullopt;
+		}
+		return item;
+	}
+
+	/**
+	 * \brief Approximate number of items
+	 */
+	std::size_t size() const {
+		long long b = bottom.load(std::memory_order_relaxed);
+		long long t = top.load(std::memory_order_relaxed);
+		return b > t ? static_cast<std::size_t>(b - t) : 0;
+	}
+
+	bool empty() const {
+		return size() == 0;
+	}
+
+	/**
+	 * \brief Current capacity of the circular array
+	 */
+	std::size_t capacity() const {
+		return array.load(std::memory_order_relaxed)->capacity;
+	}
+};
+
+#endif /* CODE_EXAMPLES_CONCURRENCY_WORK_STEALING_DEQUE_H_ */
@@ -7,10 +7,34 @@
 
 #define DOCTEST_CONFIG_IMPLEMENT
 #include "doctest.h"
+#include "commands.h"
+#include "doctest_shards.h"
+#include "perf/cpu_dispatch.h"
+#include "perf/doctest_perf_listener.h"
+#include "perf/hw_report.h"
+#include "perf/trace.h"
+
+#include <iostream>
+#include <stdexcept>
 
 namespace unit_doctest {
 
 int main(int argc, char** argv) {
+    perf_report::apply_command_line(argc, argv); // --perf-report=<file> writes time and allocations per test case as JSON
+    hw_report::apply_command_line(argc, argv);   // --hw-report=<file> writes cycles, IPC, cache and branch misses per test case as JSON
+    trace::apply_command_line(argc, argv);       // --trace=<file> writes a Chrome trace: test cases, TRACE_SCOPEs with -DTRACE_ENABLED
+    try {
+        cpu_dispatch::apply_command_line(argc, argv); // --isa=<baseline|avx2|avx512> runs the SIMD kernels on that path
+    } catch (const std::invalid_argument& error) {
+        std::cerr<<error.what()<<std::endl;
+        return 2;
+    }
+
+    int shards = doctest_shards::shard_count(argc, argv);
+    if (shards > 1) { // --shards=<N> runs the tests in N worker processes
+        return doctest_shards::run(shards, argc, argv);
+    }
+
     doctest::Context context;
 
 
@@ -36,4 +60,6 @@ int main(int argc, char** argv) {
     return res + client_stuff_return_code; // the result from doctest is propagated here as well
 }
 
+static commands::Registrar registrar{"unit_doctest", commands::Kind::test, main, "doctest unit tests (default command)"};
+
 }
@@ -0,0 +1,319 @@
+/*
+ * doctest_shards.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "doctest_shards.h"
+#include "perf/doctest_perf_listener.h"
+#include "perf/hw_report.h"
+#include "perf/trace.h"
+
+#include "doctest.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define DOCTEST_SHARDS_FORK
+#endif
+
+namespace doctest_shards {
+
+/**
+ * \brief Totals of one doctest run, filled by the "shards" listener
+ */
+struct RunResult {
+	unsigned test_cases_passing_filters;
+	unsigned test_cases_run;
+	unsigned test_cases_failed;
+	int asserts;
+	int asserts_failed;
+	bool finished;
+};
+
+RunResult last_run{};
+
+/**
+ * \brief Listener remembering the totals of the last run (and of the last --count query)
+ */
+class ShardsListener: public doctest::IReporter {
+public:
+	ShardsListener(const doctest::ContextOptions&) {}
+
+	void report_query(const doctest::QueryData& query) override {
+		if (query.run_stats) {
+			last_run.test_cases_passing_filters = query.run_stats->numTestCasesPassingFilters;
+		}
+	}
+
+	void test_run_start() override {
+		last_run = RunResult{};
+	}
+
+	void test_run_end(const doctest::TestRunStats& stats) override {
+		last_run.test_cases_passing_filters = stats.numTestCasesPassingFilters;
+		last_run.test_cases_failed = stats.numTestCasesFailed;
+		last_run.asserts = stats.numAsserts;
+		last_run.asserts_failed = stats.numAssertsFailed;
+		last_run.finished = true;
+	}
+
+	void test_case_start(const doctest::TestCaseData&) override {
+		last_run.test_cases_run++;
+	}
+
+	void test_case_reenter(const doctest::TestCaseData&) override {}
+	void test_case_end(const doctest::CurrentTestCaseStats&) override {}
+	void test_case_exception(const doctest::TestCaseException&) override {}
+	void subcase_start(const doctest::SubcaseSignature&) override {}
+	void subcase_end() override {}
+	void log_assert(const doctest::AssertData&) override {}
+	void log_message(const doctest::MessageData&) override {}
+	void test_case_skipped(const doctest::TestCaseData&) override {}
+};
+
+int shard_count(int argc, char** argv) {
+	const char* prefix = "--shards=";
+	const std::size_t prefix_length = std::strlen(prefix);
+	int result = 0;
+	for (int i = 1; i < argc; i++) {
+		if (std::strncmp(argv[i], prefix, prefix_length) == 0) {
+			result = std::atoi(argv[i] + prefix_length);
+		}
+	}
+	return result;
+}
+
+#ifdef DOCTEST_SHARDS_FORK
+
+/**
+ * \brief Number of test cases passing the filters given on the command line
+ */
+unsigned count_test_cases(int argc, char** argv) {
+	// query flags can't be set with setOption, so --count is added to the arguments
+	std::vector<const char*> args(argv, argv + argc);
+	args.push_back("--count");
+	doctest::Context context;
+	context.applyCommandLine(static_cast<int>(args.size()), args.data());
+	context.setOption("out", "/dev/null");
+	context.run();
+	return last_run.test_cases_passing_filters;
+}
+
+/**
+ * \brief What the parent knows about one worker process
+ */
+struct Shard {
+	unsigned first;		/**< One-based index of the first test case, as in --first */
+	unsigned last;		/**< One-based index of the last test case, as in --last */
+	pid_t pid;
+	std::FILE* output;	/**< Anonymous temporary file receiving stdout and stderr of the worker */
+	int exit_code;
+	std::chrono::steady_clock::time_point started;
+	double seconds;
+};
+
+/**
+ * \brief Body of the worker process, never returns
+ */
+[[noreturn]] void run_worker(int index, const Shard& shard, RunResult* result, int argc, char** argv) {
+	std::cout.flush();
+	std::fflush(stdout);
+	dup2(fileno(shard.output), STDOUT_FILENO);
+	dup2(fileno(shard.output), STDERR_FILENO);
+
+	if (!perf_report::output().empty()) {
+		perf_report::set_output(perf_report::output() + ".shard" + std::to_string(index));
+	}
+	if (!hw_report::output().empty()) {
+		hw_report::set_output(hw_report::output() + ".shard" + std::to_string(index));
+	}
+	if (!trace::output().empty()) {
+		trace::set_output(trace::output() + ".shard" + std::to_string(index));
+		trace::set_process_id(index + 1);
+	}
+
+	doctest::Context context;
+	context.applyCommandLine(argc, argv);
+	context.setOption("first", static_cast<int>(shard.first));
+	context.setOption("last", static_cast<int>(shard.last));
+	int code = context.run();
+	*result = last_run;
+
+	std::cout.flush();
+	std::cerr.flush();
+	std::fflush(nullptr);
+	_exit(code);
+}
+
+void print_output(std::FILE* output) {
+	std::fflush(output);
+	std::rewind(output);
+	char buffer[4096];
+	std::size_t read;
+	while ((read = std::fread(buffer, 1, sizeof(buffer), output)) > 0) {
+		std::cout.write(buffer, static_cast<std::streamsize>(read));
+	}
+	std::fclose(output);
+}
+
+int run(int shards, int argc, char** argv) {
+	unsigned total = count_test_cases(argc, argv);
+	if (shards > static_cast<int>(total)) {
+		shards = static_cast<int>(total);
+	}
+	if (shards <= 1) {
+		doctest::Context context;
+		context.applyCommandLine(argc, argv);
+		return context.run();
+	}
+
+	// results are written by the workers directly to memory shared with the parent
+	void* memory = mmap(nullptr, sizeof(RunResult) * shards, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (memory == MAP_FAILED) {
+		std::cerr<<"[doctest] shards: mmap failed, running serially"<<std::endl;
+		doctest::Context context;
+		context.applyCommandLine(argc, argv);
+		return context.run();
+	}
+	RunResult* results = static_cast<RunResult*>(memory);
+
+	auto started = std::chrono::steady_clock::now();
+	std::vector<Shard> workers(shards);
+	int started_workers = 0;
+	for (int i = 0; i < shards; i++) {
+		Shard& shard = workers[i];
+		shard.first = total * i / shards + 1;
+		shard.last = total * (i + 1) / shards;
+		shard.output = std::tmpfile();
+		shard.exit_code = -1;
+		shard.seconds = 0;
+		shard.pid = -1;
+		results[i] = RunResult{};
+		if (!shard.output) {
+			std::cerr<<"[doctest] shards: no temporary file for shard "<<i + 1<<", it doesn't run"<<std::endl;
+			continue;
+		}
+
+		std::cout.flush();
+		std::fflush(nullptr);
+		shard.started = std::chrono::steady_clock::now();
+		shard.pid = fork();
+		if (shard.pid == 0) {
+			run_worker(i, shard, &results[i], argc, argv);
+		}
+		if (shard.pid < 0) {
+			std::cerr<<"[doctest] shards: fork failed for shard "<<i + 1<<", it doesn't run"<<std::endl;
+			std::fclose(shard.output);
+			shard.output = nullptr;
+			continue;
+		}
+		started_workers++;
+	}
+
+	for (int running = started_workers; running > 0; running--) {
+		int status = 0;
+		pid_t pid = wait(&status);
+		if (pid < 0) {
+			break;
+		}
+		for (Shard& shard: workers) {
+			if (shard.pid == pid) {
+				shard.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - shard.started).count();
+				shard.exit_code = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+			}
+		}
+	}
+	double total_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+	RunResult merged{};
+	bool success = true;
+	std::vector<std::string> perf_reports;
+	std::vector<std::string> hw_reports;
+	std::vector<std::string> traces;
+	for (int i = 0; i < shards; i++) {
+		Shard& shard = workers[i];
+		if (shard.output) {
+			print_output(shard.output);
+		}
+		if (!results[i].finished || shard.exit_code != 0) {
+			success = false; // also a shard which never ran: its test cases are not in the totals
+		}
+		merged.test_cases_run += results[i].test_cases_run;
+		merged.test_cases_failed += results[i].test_cases_failed;
+		merged.asserts += results[i].asserts;
+		merged.asserts_failed += results[i].asserts_failed;
+		if (!perf_report::output().empty()) {
+			perf_reports.push_back(perf_report::output() + ".shard" + std::to_string(i));
+		}
+		if (!hw_report::output().empty()) {
+			hw_reports.push_back(hw_report::output() + ".shard" + std::to_string(i));
+		}
+		if (!trace::output().empty()) {
+			traces.push_back(trace::output() + ".shard" + std::to_string(i));
+		}
+	}
+	if (!perf_reports.empty()) {
+		perf_report::merge(perf_reports, perf_report::output());
+	}
+	if (!hw_reports.empty()) {
+		perf_report::merge(hw_reports, hw_report::output());
+	}
+	if (!traces.empty()) {
+		trace::merge(traces, trace::output());
+	}
+
+	std::cout<<"[doctest] shards:"<<std::endl;
+	for (int i = 0; i < shards; i++) {
+		const Shard& shard = workers[i];
+		std::cout<<"[doctest]   shard "<<i + 1<<"/"<<shards
+				<<": test cases "<<shard.first<<"-"<<shard.last
+				<<", run "<<results[i].test_cases_run
+				<<", failed "<<results[i].test_cases_failed
+				<<", assertions "<<results[i].asserts
+				<<", failed "<<results[i].asserts_failed
+				<<", "<<shard.seconds * 1000<<" ms";
+		if (shard.pid < 0) {
+			std::cout<<", did not run";
+		} else if (!results[i].finished) {
+			std::cout<<", did not finish (exit code "<<shard.exit_code<<")";
+		}
+		std::cout<<std::endl;
+	}
+	std::cout<<"[doctest] merged: test cases "<<merged.test_cases_run
+			<<" | "<<merged.test_cases_run - merged.test_cases_failed<<" passed"
+			<<" | "<<merged.test_cases_failed<<" failed"
+			<<"; assertions "<<merged.asserts
+			<<" | "<<merged.asserts - merged.asserts_failed<<" passed"
+			<<" | "<<merged.asserts_failed<<" failed"
+			<<"; wall time "<<total_seconds * 1000<<" ms"<<std::endl;
+	std::cout<<"[doctest] Status: "<<(success ? "SUCCESS!" : "FAILURE!")<<std::endl;
+
+	munmap(memory, sizeof(RunResult) * shards);
+	return success ? 0 : 1;
+}
+
+#else
+
+int run(int, int argc, char** argv) {
+	std::cerr<<"[doctest] shards: not supported on this platform, running serially"<<std::endl;
+	doctest::Context context;
+	context.applyCommandLine(argc, argv);
+	return context.run();
+}
+
+#endif
+
+}
+
+DOCTEST_REGISTER_LISTENER("shards", 2, doctest_shards::ShardsListener);
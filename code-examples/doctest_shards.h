@@ -0,0 +1,37 @@
+/*
+ * doctest_shards.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_DOCTEST_SHARDS_H_
+#define CODE_EXAMPLES_DOCTEST_SHARDS_H_
+
+/**
+ * \brief Running doctest test cases in parallel worker processes
+ *
+ * Test cases passing the filters are split into contiguous ranges (doctest's --first/--last),
+ * each range runs in its own forked process. Output of the workers is printed in shard order,
+ * followed by per-shard timing and the merged totals. A range can start in the middle of a file,
+ * so test cases must not depend on the ones run before them. A shard which couldn't be started
+ * fails the run.
+ */
+namespace doctest_shards {
+
+/**
+ * \brief Number of shards from "--shards=<N>" option, 0 if not given
+ */
+int shard_count(int argc, char** argv);
+
+/**
+ * \brief Run the tests in shards worker processes
+ *
+ * Other command line arguments (filters, order, reporters) are passed to every worker.
+ * \return 0 if all shards succeeded, 1 otherwise (like doctest::Context::run)
+ */
+int run(int shards, int argc, char** argv);
+
+}
+
+#endif /* CODE_EXAMPLES_DOCTEST_SHARDS_H_ */
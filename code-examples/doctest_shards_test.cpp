@@ -0,0 +1,31 @@
+/*
+ * doctest_shards_test.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "doctest.h"
+
+#include <cstdlib>
+#include <string>
+
+#ifdef __linux__
+#include <unistd.h>
+
+TEST_CASE("[shards] - tests sharing state across files pass with any shard count") {
+	// runs this program again on the tests of the static lab, whose files share non_static_value:
+	// with 2 and 3 shards a range boundary falls between test_file1.cpp and test_file2.cpp
+	char program[4096];
+	ssize_t length = readlink("/proc/self/exe", program, sizeof(program) - 1); // in the shell /proc/self is the shell
+	REQUIRE(length > 0);
+	program[length] = '\0';
+	for (int shards: {1, 2, 3, 4}) {
+		CAPTURE(shards);
+		std::string command = "'" + std::string{program} + "' unit_doctest --shards=" + std::to_string(shards)
+				+ " '-sf=*lab_k29_22_09_20_static*' > /dev/null 2>&1";
+		CHECK(std::system(command.c_str()) == 0);
+	}
+}
+
+#endif
@@ -7,6 +7,7 @@
 #ifdef CATCH_ENABLED
 //#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
 #include "catch.hpp"
+#include "perf/alloc_check.h"
 #include <vector>
 
 unsigned int Factorial( unsigned int number ) {
@@ -21,6 +22,19 @@ TEST_CASE( "Factorials are computed", "[factorial]" ) {
     REQUIRE( Factorial(10) == 3628800 );
 }
 
+#ifdef CATCH_CONFIG_ENABLE_BENCHMARKING
+TEST_CASE( "Factorial benchmarks", "[.][benchmark][factorial]" ) {
+    volatile unsigned int small = 3, large = 12; // volatile - not to be computed at compile time
+
+    BENCHMARK( "Factorial(3)" ) {
+        return Factorial(small);
+    };
+    BENCHMARK( "Factorial(12)" ) {
+        return Factorial(large);
+    };
+}
+#endif
+
 TEST_CASE( "vectors can be sized and resized", "[vector]" ) {
 
     std::vector<int> v( 5 );
@@ -35,19 +49,19 @@ TEST_CASE( "vectors can be sized and resized", "[vector]" ) {
         REQUIRE( v.capacity() >= 10 );
     }
     SECTION( "resizing smaller changes size but not capacity" ) {
-        v.resize( 0 );
+        REQUIRE_NO_ALLOC( v.resize( 0 ) );
 
         REQUIRE( v.size() == 0 );
         REQUIRE( v.capacity() >= 5 );
     }
     SECTION( "reserving bigger changes capacity but not size" ) {
-        v.reserve( 10 );
+        CHECK_ALLOCATIONS_LE( 1, v.reserve( 10 ) );
 
         REQUIRE( v.size() == 5 );
         REQUIRE( v.capacity() >= 10 );
     }
     SECTION( "reserving smaller does not change size or capacity" ) {
-        v.reserve( 0 );
+        REQUIRE_NO_ALLOC( v.reserve( 0 ) );
 
         REQUIRE( v.size() == 5 );
         REQUIRE( v.capacity() >= 5 );
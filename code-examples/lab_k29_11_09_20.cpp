@@ -1,78 +1,21 @@
+#include "lab_k29_11_09_20.h"
+#include "commands.h"
+
+#include "doctest.h"
+#include "perf/alloc_check.h"
+#include "perf/cpu_dispatch.h"
+#include "perf/hw_report.h"
+
 #include <cstring>
 #include <algorithm>
 #include <iostream>
+#include <optional>
+#include <utility>
 
-namespace lab_k29_11_09_20 {
-
-class string
-{
-    char* data;
+#include <sys/mman.h>
+#include <unistd.h>
 
-public:
-
-	string() {
-		std::cout<<"default ctor"<<std::endl;
-		data = nullptr;
-	}
-
-    string(const char* p)
-    {
-    	std::cout<<"ctor "<<p<<std::endl;
-        size_t size = std::strlen(p) + 1;
-        data = new char[size];
-        std::memcpy(data, p, size);
-    }
-
-    ~string()
-    {
-    	if (this->data) {
-			std::cout<<"dtor "<<this->data<<std::endl;
-			delete[] data;
-    	} else {
-    		std::cout<<"dtor for empty data"<<std::endl;
-    	}
-    }
-
-    string(const string& that)
-    {
-    	std::cout<<"copy "<< that.data<<std::endl;
-        size_t size = std::strlen(that.data) + 1;
-        data = new char[size];
-        std::memcpy(data, that.data, size);
-    }
-
-    string(string&& that)   // string&& is an rvalue reference to a string
-    {
-    	std::cout<<"move "<<that.data<<std::endl;
-        data = that.data;
-        that.data = nullptr;
-        //std::cout<<"moved"<<std::endl;
-    }
-
-    string& operator=(const string& that) {
-    	std::cout<<"assign "<<that.data<<std::endl;
-    	delete [] data;
-    	size_t size = std::strlen(that.data) + 1;
-        data = new char[size];
-        std::memcpy(data, that.data, size);
-    	return *this;
-    }
-
-    string operator+(const string& second) {
-    	std::cout<<"plus("<<this->data<<","<<second.data<<")"<<std::endl;
-    	char* buf = new char[std::strlen(this->data) +
-    						std::strlen(second.data) + 1];
-    	std::memcpy(buf, this->data, std::strlen(this->data));
-    	return std::strcat(buf,second.data);
-    }
-
-    void print() {
-    	std::cout<<data<<std::endl;
-    }
-
-    friend string twice( string& value);
-    friend string twice( string&& value);
-};
+namespace lab_k29_11_09_20 {
 
 string helloworld() {
 	return "hello world";
@@ -131,4 +74,105 @@ int main(int argc, char** argv) {
 	return 0;
 }
 
+/**
+ * \brief Disables std::cout while in scope, every constructor and destructor of string prints
+ */
+class SilentCout {
+private:
+	std::streambuf* buffer;
+public:
+	SilentCout(): buffer{std::cout.rdbuf(nullptr)} {}
+	~SilentCout() {
+		std::cout.rdbuf(buffer);
+		std::cout.clear();
+	}
+};
+
+TEST_CASE("[string] - copy allocates, move does not") {
+	// doctest reports to std::cout too, only the string operations are silenced
+	auto silently = [](auto function) {
+		SilentCout silent;
+		function();
+	};
+	std::optional<string> original, target;
+	silently([&]() {
+		original.emplace("hello world");
+		target.emplace("target");
+	});
+
+	CHECK_ALLOCATIONS_LE(1, silently([&]() { string copy{*original}; }));
+	CHECK_ALLOCATIONS_LE(1, silently([&]() { *target = *original; }));
+	REQUIRE_NO_ALLOC(silently([&]() { string moved{std::move(*target)}; })); // takes the buffer
+
+	silently([&]() {
+		original.reset();
+		target.reset();
+	});
+}
+
+TEST_CASE("[string] - length and count on every instruction set, up to a page which can't be read") {
+	// two pages, the second one inaccessible: strings end right before it, at every alignment
+	long page = sysconf(_SC_PAGESIZE);
+	void* memory = mmap(nullptr, 2 * page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	REQUIRE(memory != MAP_FAILED);
+	REQUIRE(mprotect(static_cast<char*>(memory) + page, page, PROT_NONE) == 0);
+	char* end = static_cast<char*>(memory) + page - 1;
+	*end = '\0';
+	std::memset(memory, 'a', page - 1);
+	for (long i = 0; i < page - 1; i += 3) {
+		static_cast<char*>(memory)[i] = 'b';
+	}
+
+	for (cpu_dispatch::Isa isa: {cpu_dispatch::Isa::baseline, cpu_dispatch::Isa::avx2, cpu_dispatch::Isa::avx512}) {
+		if (!cpu_dispatch::supported(isa)) {
+			continue;
+		}
+		CAPTURE(cpu_dispatch::name(isa));
+		cpu_dispatch::ForceScope scope{isa};
+		bool exact = true;
+		for (std::size_t size = 0; size < 300; size++) {
+			const char* p = end - size;
+			exact = exact && length(p) == size && count(p, 'b') == static_cast<std::size_t>(std::count(p, p + size, 'b'))
+					&& count(p, 'c') == 0 && count(p, '\0') == 0;
+		}
+		CHECK(exact);
+		CHECK(length(static_cast<char*>(memory)) == static_cast<std::size_t>(page - 1));
+
+		std::size_t size, o_count, empty_size;
+		{
+			SilentCout silent;
+			string text{"hello world"};
+			size = text.size();
+			o_count = text.count('o');
+			empty_size = string{}.size();
+		}
+		CHECK(size == 11);
+		CHECK(o_count == 2);
+		CHECK(empty_size == 0);
+	}
+	munmap(memory, 2 * page);
+}
+
+TEST_CASE("[string] - copying long strings") {
+	// copies and concatenations of 64 KiB: with --hw-report the misses are reported per copied byte
+	const std::size_t size = 1 << 16;
+	std::string text(size, 'x');
+	std::size_t total = 0, copied = 0;
+	{
+		SilentCout silent;
+		string original{text.c_str()};
+		for (int i = 0; i < 16; i++) {
+			string copy{original};
+			string twice = copy + original;
+			total += twice.size();
+			copied += 5 * size; // the copy, and operator+ copies both halves into a buffer and the buffer into the result
+		}
+	}
+	hw_report::set_elements(static_cast<long long>(copied));
+	CHECK(total == 16 * 2 * size);
+}
+
+static commands::Registrar registrar{"lab_k29_11_09_20", commands::Kind::example, main,
+		"lab of Sep 11, 2020: strings"};
+
 }
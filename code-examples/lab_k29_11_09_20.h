@@ -0,0 +1,120 @@
+/*
+ * lab_k29_11_09_20.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_LAB_K29_11_09_20_H_
+#define CODE_EXAMPLES_LAB_K29_11_09_20_H_
+
+#include "perf/trace.h"
+
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+
+namespace lab_k29_11_09_20 {
+
+/**
+ * \brief std::strlen with SSE2, AVX2 or AVX-512 (cpu_dispatch)
+ */
+std::size_t length(const char* p);
+
+/**
+ * \brief Number of bytes equal to c in the string p (0 for c == '\0')
+ */
+std::size_t count(const char* p, char c);
+
+class string
+{
+    char* data;
+
+public:
+
+	string() {
+		std::cout<<"default ctor"<<std::endl;
+		data = nullptr;
+	}
+
+    string(const char* p)
+    {
+    	std::cout<<"ctor "<<p<<std::endl;
+        TRACE_SCOPE("string::string(const char*)");
+        size_t size = length(p) + 1;
+        TRACE_COUNTER("string allocation bytes", size);
+        data = new char[size];
+        std::memcpy(data, p, size);
+    }
+
+    ~string()
+    {
+    	if (this->data) {
+			std::cout<<"dtor "<<this->data<<std::endl;
+			delete[] data;
+    	} else {
+    		std::cout<<"dtor for empty data"<<std::endl;
+    	}
+    }
+
+    string(const string& that)
+    {
+    	std::cout<<"copy "<< that.data<<std::endl;
+        TRACE_SCOPE("string::string(const string&)");
+        size_t size = length(that.data) + 1;
+        TRACE_COUNTER("string allocation bytes", size);
+        data = new char[size];
+        std::memcpy(data, that.data, size);
+    }
+
+    string(string&& that)   // string&& is an rvalue reference to a string
+    {
+    	std::cout<<"move "<<that.data<<std::endl;
+        data = that.data;
+        that.data = nullptr;
+        //std::cout<<"moved"<<std::endl;
+    }
+
+    string& operator=(const string& that) {
+    	std::cout<<"assign "<<that.data<<std::endl;
+    	TRACE_SCOPE("string::operator=");
+    	delete [] data;
+    	size_t size = length(that.data) + 1;
+    	TRACE_COUNTER("string allocation bytes", size);
+        data = new char[size];
+        std::memcpy(data, that.data, size);
+    	return *this;
+    }
+
+    string operator+(const string& second) {
+    	std::cout<<"plus("<<this->data<<","<<second.data<<")"<<std::endl;
+    	TRACE_SCOPE("string::operator+");
+    	size_t first_size = length(this->data);
+    	size_t second_size = length(second.data) + 1; // with '\0'
+    	char* buf = new char[first_size + second_size];
+    	std::memcpy(buf, this->data, first_size);
+    	std::memcpy(buf + first_size, second.data, second_size);
+    	string result{buf}; // copies buf
+    	delete[] buf;
+    	return result;
+    }
+
+    void print() {
+    	std::cout<<data<<std::endl;
+    }
+
+    std::size_t size() const {
+    	return data ? length(data) : 0;
+    }
+
+    std::size_t count(char c) const {
+    	return data ? lab_k29_11_09_20::count(data, c) : 0;
+    }
+
+    friend string twice( string& value);
+    friend string twice( string&& value);
+};
+
+}
+
+#endif /* CODE_EXAMPLES_LAB_K29_11_09_20_H_ */
@@ -0,0 +1,198 @@
+/*
+ * lab_k29_11_09_20_scan.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "lab_k29_11_09_20.h"
+
+#include "perf/cpu_dispatch.h"
+
+#include <cstdint>
+
+#ifdef CPU_DISPATCH_X86
+#include <immintrin.h>
+#endif
+
+// The scans load whole aligned blocks, like glibc strlen: a block never crosses a page, so reading the bytes
+// before p and after the terminator can't fault, and they are masked out. AddressSanitizer would report them.
+#if defined(__has_attribute)
+#if __has_attribute(no_sanitize_address)
+#define SCAN_NO_SANITIZE __attribute__((no_sanitize_address))
+#endif
+#endif
+#ifndef SCAN_NO_SANITIZE
+#define SCAN_NO_SANITIZE
+#endif
+
+namespace lab_k29_11_09_20 {
+
+namespace {
+
+template<std::size_t alignment>
+const char* align_down(const char* p) {
+	return reinterpret_cast<const char*>(reinterpret_cast<std::uintptr_t>(p) & ~std::uintptr_t{alignment - 1});
+}
+
+#ifdef CPU_DISPATCH_X86
+
+SCAN_NO_SANITIZE std::size_t length_sse2(const char* p) {
+	const char* block = align_down<16>(p);
+	const __m128i zero = _mm_setzero_si128();
+	std::uint32_t zeros = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(block)), zero));
+	zeros >>= p - block;
+	if (zeros) {
+		return __builtin_ctz(zeros);
+	}
+	for (;;) {
+		block += 16;
+		zeros = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(block)), zero));
+		if (zeros) {
+			return block - p + __builtin_ctz(zeros);
+		}
+	}
+}
+
+SCAN_NO_SANITIZE std::size_t count_sse2(const char* p, char c) {
+	const char* block = align_down<16>(p);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i needle = _mm_set1_epi8(c);
+	std::uint32_t skipped = ~0u << (p - block);
+	std::size_t result = 0;
+	for (;; block += 16) {
+		__m128i bytes = _mm_load_si128(reinterpret_cast<const __m128i*>(block));
+		std::uint32_t zeros = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, zero)) & skipped;
+		std::uint32_t matches = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, needle)) & skipped;
+		skipped = ~0u;
+		if (zeros) {
+			return result + __builtin_popcount(matches & ((zeros & -zeros) - 1));
+		}
+		result += __builtin_popcount(matches);
+	}
+}
+
+CPU_DISPATCH_AVX2 SCAN_NO_SANITIZE std::size_t length_avx2(const char* p) {
+	const char* block = align_down<32>(p);
+	const __m256i zero = _mm256_setzero_si256();
+	std::uint32_t zeros = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(block)), zero));
+	zeros >>= p - block;
+	if (zeros) {
+		return _tzcnt_u32(zeros);
+	}
+	for (;;) {
+		block += 32;
+		zeros = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(block)), zero));
+		if (zeros) {
+			return block - p + _tzcnt_u32(zeros);
+		}
+	}
+}
+
+CPU_DISPATCH_AVX2 SCAN_NO_SANITIZE std::size_t count_avx2(const char* p, char c) {
+	const char* block = align_down<32>(p);
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i needle = _mm256_set1_epi8(c);
+	std::uint32_t skipped = ~0u << (p - block);
+	std::size_t result = 0;
+	for (;; block += 32) {
+		__m256i bytes = _mm256_load_si256(reinterpret_cast<const __m256i*>(block));
+		std::uint32_t zeros = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, zero))) & skipped;
+		std::uint32_t matches = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, needle))) & skipped;
+		skipped = ~0u;
+		if (zeros) {
+			return result + _mm_popcnt_u32(_bzhi_u32(matches, _tzcnt_u32(zeros)));
+		}
+		result += _mm_popcnt_u32(matches);
+	}
+}
+
+CPU_DISPATCH_AVX512 SCAN_NO_SANITIZE inline std::uint64_t zero_mask(const char* block) {
+	__m512i bytes = _mm512_load_si512(block);
+	return _mm512_testn_epi8_mask(bytes, bytes);
+}
+
+CPU_DISPATCH_AVX512 SCAN_NO_SANITIZE std::size_t length_avx512(const char* p) {
+	const char* block = align_down<64>(p);
+	std::uint64_t zeros = zero_mask(block);
+	zeros >>= p - block;
+	if (zeros) {
+		return _tzcnt_u64(zeros);
+	}
+	for (;;) {
+		block += 64;
+		zeros = zero_mask(block);
+		if (zeros) {
+			return block - p + _tzcnt_u64(zeros);
+		}
+	}
+}
+
+CPU_DISPATCH_AVX512 SCAN_NO_SANITIZE std::size_t count_avx512(const char* p, char c) {
+	const char* block = align_down<64>(p);
+	const __m512i needle = _mm512_set1_epi8(c);
+	std::uint64_t skipped = ~std::uint64_t{0} << (p - block);
+	std::size_t result = 0;
+	for (;; block += 64) {
+		__m512i bytes = _mm512_load_si512(block);
+		std::uint64_t zeros = _mm512_testn_epi8_mask(bytes, bytes) & skipped;
+		std::uint64_t matches = _mm512_cmpeq_epi8_mask(bytes, needle) & skipped;
+		skipped = ~std::uint64_t{0};
+		if (zeros) {
+			return result + _mm_popcnt_u64(_bzhi_u64(matches, _tzcnt_u64(zeros)));
+		}
+		result += _mm_popcnt_u64(matches);
+	}
+}
+
+cpu_dispatch::Kernel<std::size_t(const char*)>& length_kernel() {
+	static cpu_dispatch::Kernel<std::size_t(const char*)> kernel{length_sse2, length_avx2, length_avx512};
+	return kernel;
+}
+
+cpu_dispatch::Kernel<std::size_t(const char*, char)>& count_kernel() {
+	static cpu_dispatch::Kernel<std::size_t(const char*, char)> kernel{count_sse2, count_avx2, count_avx512};
+	return kernel;
+}
+
+#else
+
+std::size_t length_scalar(const char* p) {
+	const char* end = p;
+	while (*end) {
+		end++;
+	}
+	return end - p;
+}
+
+std::size_t count_scalar(const char* p, char c) {
+	std::size_t result = 0;
+	for (; *p; p++) {
+		result += *p == c;
+	}
+	return result;
+}
+
+cpu_dispatch::Kernel<std::size_t(const char*)>& length_kernel() {
+	static cpu_dispatch::Kernel<std::size_t(const char*)> kernel{length_scalar, nullptr, nullptr};
+	return kernel;
+}
+
+cpu_dispatch::Kernel<std::size_t(const char*, char)>& count_kernel() {
+	static cpu_dispatch::Kernel<std::size_t(const char*, char)> kernel{count_scalar, nullptr, nullptr};
+	return kernel;
+}
+
+#endif
+
+}
+
+std::size_t length(const char* p) {
+	return length_kernel()(p);
+}
+
+std::size_t count(const char* p, char c) {
+	return c ? count_kernel()(p, c) : 0;
+}
+
+}
@@ -5,54 +5,20 @@
  *      Author: KZ
  */
 
+#include "rational.h"
+
 #include "doctest.h"
+#include "perf/alloc_check.h"
+#include "perf/check_all.h"
+#include "perf/cpu_dispatch.h"
+#include <cstdlib>
+#include <limits>
+#include <numeric>
+#include <random>
 #include <stdexcept>
+#include <vector>
 
 
-class Rational {
-	int numerator;
-	int denominator;
-//private:
-//	static const Rational _one;
-public:
-	Rational(): numerator{0}, denominator{1} {}
-	Rational(int numerator, int denominator): numerator{numerator}, denominator{denominator} {}
-
-	int get_numerator() const {return numerator;}
-	int get_denominator() const {return denominator;}
-	void set_numerator(int numerator) { this->numerator = numerator; }
-	void set_denominator(int denominator) {
-		if (denominator == 0) {
-			throw std::invalid_argument("denominator");
-		}
-		this->denominator = denominator;
-	}
-
-	static const Rational zero;
-
-	static const Rational one() {
-		static const Rational _one{1,1};
-		return _one;
-	}
-
-	static Rational test_value() {
-		static Rational test_value{1,2};
-		return test_value;
-	}
-
-	static Rational& test_ref() {
-		static Rational test_value{1,2};
-		return test_value;
-	}
-
-	static int GCD(int a, int b) {
-		// this->zero; //this is unavailable in static methods
-		// Rational::zero; //static fields are available
-		return b ? GCD (b, a % b) : a;
-	}
-
-};
-
 const Rational Rational::zero{0,1};
 //const Rational Rational::_one{1,1};
 
@@ -119,6 +85,106 @@ TEST_CASE("Static methods") {
 	CHECK(Rational::GCD(0, 0) == 0);
 }
 
+TEST_CASE("Static methods - batched GCD on every instruction set") {
+	std::mt19937 random{20261018};
+	std::uniform_int_distribution<int> any{std::numeric_limits<int>::min() + 1, std::numeric_limits<int>::max()};
+	std::uniform_int_distribution<int> small{-64, 64};
+	std::vector<int> a, b;
+	for (int i = 0; i < 2000; i++) {
+		int common = 1 << (small(random) & 7);
+		bool both_small = i % 2;
+		a.push_back(both_small ? small(random) * common : any(random));
+		b.push_back(both_small ? small(random) * common : any(random));
+	}
+	a.insert(a.end(), {0, 0, 17, std::numeric_limits<int>::min(), std::numeric_limits<int>::min(), 1 << 30, -6});
+	b.insert(b.end(), {0, 17, 0, 6, std::numeric_limits<int>::min() + 2, 1 << 30, -4});
+
+	for (cpu_dispatch::Isa isa: {cpu_dispatch::Isa::baseline, cpu_dispatch::Isa::avx2, cpu_dispatch::Isa::avx512}) {
+		if (!cpu_dispatch::supported(isa)) {
+			continue;
+		}
+		CAPTURE(cpu_dispatch::name(isa));
+		cpu_dispatch::ForceScope scope{isa};
+		for (std::size_t count: {std::size_t{0}, std::size_t{5}, std::size_t{21}, a.size()}) {
+			std::size_t offset = a.size() - count; // the special cases are at the end
+			std::vector<int> gcds(count, -1);
+			Rational::GCD(a.data() + offset, b.data() + offset, gcds.data(), count);
+			std::vector<std::size_t> indices(count);
+			std::iota(indices.begin(), indices.end(), 0);
+			CHECK_ALL(indices, [&](std::size_t i) { return gcds[i] == std::gcd(1LL * a[offset + i], 1LL * b[offset + i]); });
+		}
+	}
+}
+
+TEST_CASE("Rational arithmetic") {
+	Rational half{1,2}, third{1,3};
+
+	Rational sum = half + third;
+	CHECK(sum.get_numerator() == 5);
+	CHECK(sum.get_denominator() == 6);
+
+	Rational difference = third - half;
+	CHECK(difference.get_numerator() == -1);
+	CHECK(difference.get_denominator() == 6);
+
+	Rational product = Rational{2,3} * Rational{3,4};
+	CHECK(product.get_numerator() == 1); // reduced from 6/12
+	CHECK(product.get_denominator() == 2);
+
+	Rational quotient = half / Rational{-1,4};
+	CHECK(quotient.get_numerator() == -2); // sign is kept in the numerator
+	CHECK(quotient.get_denominator() == 1);
+
+	CHECK(Rational{1,2} == Rational{2,4});
+	CHECK(Rational{1,2} != Rational{1,3});
+
+	CHECK_THROWS_AS(half / Rational::zero, std::invalid_argument);
+
+	// 65537/65536 squared is 4295098369/4294967296: both coprime and above INT_MAX after reduction
+	Rational big{65537, 65536};
+	CHECK_THROWS_AS(big * big, std::overflow_error);
+	CHECK_THROWS_AS(Rational::reduced(1LL << 31, 3), std::overflow_error);
+	CHECK_THROWS_AS(Rational::reduced(1, -(1LL << 31)), std::overflow_error);
+	Rational fits = Rational::reduced(-(1LL << 31), 1); // INT_MIN itself fits
+	CHECK(fits.get_numerator() == std::numeric_limits<int>::min());
+	Rational reduces = Rational::reduced(3LL << 31, 3LL << 32); // fits only after reduction
+	CHECK(reduces.get_numerator() == 1);
+	CHECK(reduces.get_denominator() == 2);
+
+	// two ints by value, no heap
+	CHECK_NO_ALLOC(half + third);
+	CHECK_NO_ALLOC(third - half);
+	CHECK_NO_ALLOC(half * third);
+	CHECK_NO_ALLOC(half / third);
+	CHECK_NO_ALLOC(half == third);
+	CHECK_NO_ALLOC(Rational::GCD(1134903170, 701408733));
+}
+
+TEST_CASE("Rational arithmetic - random fractions") {
+	// numerators and denominators below 1000: the intermediate products fit in int
+	std::mt19937 random{20200916};
+	std::uniform_int_distribution<int> numerators{-999, 999};
+	std::uniform_int_distribution<int> denominators{1, 999};
+	struct Pair {
+		Rational a;
+		Rational b;
+	};
+	std::vector<Pair> pairs;
+	for (int i = 0; i < 100000; i++) {
+		pairs.push_back({Rational{numerators(random), denominators(random)}, Rational{numerators(random), denominators(random)}});
+	}
+
+	// 100000 values per CHECK_ALL, a CHECK for each would take most of the time of the test
+	CHECK_ALL(pairs, [](const Pair& pair) { return (pair.a + pair.b) - pair.b == pair.a; });
+	CHECK_ALL(pairs, [](const Pair& pair) { return pair.a + pair.b == pair.b + pair.a; });
+	CHECK_ALL(pairs, [](const Pair& pair) { return pair.a * pair.b == pair.b * pair.a; });
+	CHECK_ALL(pairs, [](const Pair& pair) { return pair.b == Rational::zero || (pair.a * pair.b) / pair.b == pair.a; });
+	CHECK_ALL(pairs, [](const Pair& pair) {
+		Rational sum = pair.a + pair.b;
+		return sum.get_denominator() > 0 && Rational::GCD(std::abs(sum.get_numerator()), sum.get_denominator()) == 1;
+	});
+}
+
 TEST_CASE("Static inside method") {
 	CHECK(Rational::test_value().get_numerator() == 1);
 	CHECK(Rational::test_value().get_denominator() == 2);
@@ -9,4 +9,5 @@
 #include "test_static.h"
 
 int non_static_value = 123;
+ShardedCounter<> shared_counter;
 
@@ -18,6 +18,14 @@ TEST_CASE("static in namespace") {
 	CHECK(static_value == 4560);
 	CHECK(non_static_value == 1230);
 
+	// non_static_value is shared with test_file2.cpp: restored, so that the tests pass in any order and in any shard
+	non_static_value = 123;
 }
 
-
+TEST_CASE("sharded counter in namespace") {
+	// doesn't depend on the order of tests - only on the increments made here
+	long long before = shared_counter.load();
+	++shared_counter;
+	shared_counter += 1;
+	CHECK(shared_counter.load() == before + 2);
+}
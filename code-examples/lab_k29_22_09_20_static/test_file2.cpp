@@ -9,8 +9,8 @@
 #include "../doctest.h"
 
 TEST_CASE("static in namespace") {
-	CHECK(static_value == 456);
-	CHECK(non_static_value == 1230); //already set in test_file1.cpp
+	CHECK(static_value == 456);  // this file's own copy, even after test_file1.cpp set its copy to 4560
+	CHECK(non_static_value == 123); // the one from init_non_static.cpp, test_file1.cpp restores it after changing
 
 	static_value = 4561;
 	non_static_value = 1231;
@@ -18,6 +18,13 @@ TEST_CASE("static in namespace") {
 	CHECK(static_value == 4561);
 	CHECK(non_static_value == 1231);
 
+	non_static_value = 123;
 }
 
-
+TEST_CASE("sharded counter in namespace") {
+	// doesn't depend on the order of tests - only on the increments made here
+	long long before = shared_counter.load();
+	++shared_counter;
+	shared_counter += 2;
+	CHECK(shared_counter.load() == before + 3);
+}
@@ -9,9 +9,16 @@
 #define CODE_EXAMPLES_LAB_K29_22_09_20_STATIC_TEST_STATIC_H_
 
 
+#include "../concurrency/sharded_counter.h"
+
+// one variable for the whole program: tests which change it restore 123, so they don't depend on each other's order
 extern int non_static_value;
+// a copy in every file which includes this header
 static int static_value = 456;
 
+// shared by all files like non_static_value, but safe to increment from many threads
+extern ShardedCounter<> shared_counter;
+
 
 
 
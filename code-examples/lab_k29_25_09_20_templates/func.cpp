@@ -7,6 +7,9 @@
 
 #include "func.h"
 
+#include <limits>
+#include <type_traits>
+
 // Approach 3: move implementation to cpp file
 template<typename T>
 T square(T value) {
@@ -17,4 +20,30 @@ T square(T value) {
 template int square<int>(int value);
 template double square<double>(double value);
 
+// the square of any int32 fits in 64 bits, at most 2^62
+template<typename T>
+T square_sat(T value) {
+	static_assert(std::is_signed<T>::value && sizeof(T) <= 4, "signed integers up to 32 bits");
+	std::int64_t result = std::int64_t{value}*value;
+	return result > std::numeric_limits<T>::max() ? std::numeric_limits<T>::max() : static_cast<T>(result);
+}
+
+// 2^62 plus the rounding term 2^(FracBits - 1) still fits in 64 bits
+template<typename T, int FracBits>
+T square_q(T value) {
+	static_assert(std::is_signed<T>::value && sizeof(T) <= 4, "signed integers up to 32 bits");
+	static_assert(FracBits > 0 && FracBits < std::numeric_limits<T>::digits + 1, "fraction bits of T");
+	std::int64_t result = (std::int64_t{value}*value + (std::int64_t{1} << (FracBits - 1))) >> FracBits;
+	return result > std::numeric_limits<T>::max() ? std::numeric_limits<T>::max() : static_cast<T>(result);
+}
+
+template std::int8_t square_sat<std::int8_t>(std::int8_t value);
+template std::int16_t square_sat<std::int16_t>(std::int16_t value);
+template std::int32_t square_sat<std::int32_t>(std::int32_t value);
+
+template std::int8_t square_q<std::int8_t, 7>(std::int8_t value);
+template std::int16_t square_q<std::int16_t, 8>(std::int16_t value);
+template std::int16_t square_q<std::int16_t, 15>(std::int16_t value);
+template std::int32_t square_q<std::int32_t, 31>(std::int32_t value);
+
 
@@ -8,9 +8,49 @@
 #ifndef CODE_EXAMPLES_LAB_K29_25_09_20_TEMPLATES_FUNC_H_
 #define CODE_EXAMPLES_LAB_K29_25_09_20_TEMPLATES_FUNC_H_
 
+#include <cstddef>
+#include <cstdint>
+
 template<typename T>
 T square(T value);
 
+/**
+ * \brief squares[i] = square(values[i]) for int and double, with SSE2, AVX2 or AVX-512 (cpu_dispatch)
+ *
+ * Squares of int which don't fit wrap around (the low 32 bits). values and squares may be the same array.
+ */
+template<typename T>
+void square(const T* values, T* squares, std::size_t count);
+
+/**
+ * \brief Square which saturates at the largest T instead of overflowing, for std::int8_t, std::int16_t, std::int32_t
+ */
+template<typename T>
+T square_sat(T value);
+
+/**
+ * \brief Square of a fixed-point number with FracBits fraction bits, rounded half up and saturated
+ *
+ * (value² + 2^(FracBits - 1)) >> FracBits: for Q7 (std::int8_t, 7), Q8.8 (std::int16_t, 8), Q15 (std::int16_t, 15)
+ * and Q31 (std::int32_t, 31). Only -1 squared (-2^FracBits in Q7, Q15, Q31) doesn't fit and becomes the largest T.
+ */
+template<typename T, int FracBits>
+T square_q(T value);
+
+/**
+ * \brief squares[i] = square_sat(values[i]) with packed saturating instructions (cpu_dispatch)
+ *
+ * int8 and int16 with SSE2, AVX2 or AVX-512BW; int32 with AVX2 or AVX-512, scalar on the baseline.
+ */
+template<typename T>
+void square_sat(const T* values, T* squares, std::size_t count);
+
+/**
+ * \brief squares[i] = square_q<T, FracBits>(values[i]), like square_sat()
+ */
+template<typename T, int FracBits>
+void square_q(const T* values, T* squares, std::size_t count);
+
 //Approach 2: include implementation header in declaration header
 //#include "func.hxx"
 
@@ -0,0 +1,314 @@
+/*
+ * func_simd.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "func.h"
+
+#include "../perf/cpu_dispatch.h"
+
+#include <cstdint>
+#include <limits>
+
+#ifdef CPU_DISPATCH_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+
+template<typename T>
+void square_scalar(const T* values, T* squares, std::size_t count) {
+	for (std::size_t i = 0; i < count; i++) {
+		squares[i] = values[i]*values[i];
+	}
+}
+
+// int squares go through unsigned, so that they wrap around like the vector ones
+void square_scalar_wrap(const int* values, int* squares, std::size_t count) {
+	for (std::size_t i = 0; i < count; i++) {
+		std::uint32_t value = static_cast<std::uint32_t>(values[i]);
+		squares[i] = static_cast<int>(value*value);
+	}
+}
+
+// Saturated squares: square_q<T, FracBits>, square_sat<T> is FracBits == 0 (no rounding)
+template<int FracBits>
+constexpr std::int64_t rounding = FracBits ? std::int64_t{1} << (FracBits - 1) : 0;
+
+template<typename T, int FracBits>
+void saturated_scalar(const T* values, T* squares, std::size_t count) {
+	for (std::size_t i = 0; i < count; i++) {
+		if constexpr (FracBits == 0) {
+			squares[i] = square_sat(values[i]);
+		} else {
+			squares[i] = square_q<T, FracBits>(values[i]);
+		}
+	}
+}
+
+#ifdef CPU_DISPATCH_X86
+
+// SSE2 has no 32-bit mullo: even lanes and odd lanes are multiplied into 64 bits and the low halves interleaved
+void square_sse2(const int* values, int* squares, std::size_t count) {
+	std::size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+		__m128i odd = _mm_srli_epi64(value, 32);
+		__m128i even_squares = _mm_mul_epu32(value, value);
+		__m128i odd_squares = _mm_mul_epu32(odd, odd);
+		__m128i square = _mm_unpacklo_epi32(_mm_shuffle_epi32(even_squares, _MM_SHUFFLE(0, 0, 2, 0)),
+				_mm_shuffle_epi32(odd_squares, _MM_SHUFFLE(0, 0, 2, 0)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(squares + i), square);
+	}
+	square_scalar_wrap(values + i, squares + i, count - i);
+}
+
+void square_sse2(const double* values, double* squares, std::size_t count) {
+	std::size_t i = 0;
+	for (; i + 2 <= count; i += 2) {
+		__m128d value = _mm_loadu_pd(values + i);
+		_mm_storeu_pd(squares + i, _mm_mul_pd(value, value));
+	}
+	square_scalar(values + i, squares + i, count - i);
+}
+
+CPU_DISPATCH_AVX2 void square_avx2(const int* values, int* squares, std::size_t count) {
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(squares + i), _mm256_mullo_epi32(value, value));
+	}
+	square_scalar_wrap(values + i, squares + i, count - i);
+}
+
+CPU_DISPATCH_AVX2 void square_avx2(const double* values, double* squares, std::size_t count) {
+	std::size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m256d value = _mm256_loadu_pd(values + i);
+		_mm256_storeu_pd(squares + i, _mm256_mul_pd(value, value));
+	}
+	square_scalar(values + i, squares + i, count - i);
+}
+
+// the tail is one masked iteration
+CPU_DISPATCH_AVX512 void square_avx512(const int* values, int* squares, std::size_t count) {
+	for (std::size_t i = 0; i < count; i += 16) {
+		__mmask16 mask = count - i >= 16 ? 0xffff : static_cast<__mmask16>((1u << (count - i)) - 1);
+		__m512i value = _mm512_maskz_loadu_epi32(mask, values + i);
+		_mm512_mask_storeu_epi32(squares + i, mask, _mm512_mullo_epi32(value, value));
+	}
+}
+
+CPU_DISPATCH_AVX512 void square_avx512(const double* values, double* squares, std::size_t count) {
+	for (std::size_t i = 0; i < count; i += 8) {
+		__mmask8 mask = count - i >= 8 ? 0xff : static_cast<__mmask8>((1u << (count - i)) - 1);
+		__m512d value = _mm512_maskz_loadu_pd(mask, values + i);
+		_mm512_mask_storeu_pd(squares + i, mask, _mm512_mul_pd(value, value));
+	}
+}
+
+template<typename T>
+cpu_dispatch::Kernel<void(const T*, T*, std::size_t)>& kernel() {
+	static cpu_dispatch::Kernel<void(const T*, T*, std::size_t)> kernel{square_sse2, square_avx2, square_avx512};
+	return kernel;
+}
+
+// int8 lanes are sign extended to 16 bits (unpacked with themselves and shifted), squared there without overflow
+// and packed back with signed saturation; int16 squares are interleaved from the low and high halves into 32 bits.
+// Unpacking and packing both work within 128-bit lanes, so the order comes out right for AVX2 and AVX-512 too.
+template<int FracBits>
+void saturated_sse2(const std::int8_t* values, std::int8_t* squares, std::size_t count) {
+	const __m128i round = _mm_set1_epi16(static_cast<short>(rounding<FracBits>));
+	std::size_t i = 0;
+	for (; i + 16 <= count; i += 16) {
+		__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+		__m128i low = _mm_srai_epi16(_mm_unpacklo_epi8(value, value), 8);
+		__m128i high = _mm_srai_epi16(_mm_unpackhi_epi8(value, value), 8);
+		low = _mm_srai_epi16(_mm_add_epi16(_mm_mullo_epi16(low, low), round), FracBits);
+		high = _mm_srai_epi16(_mm_add_epi16(_mm_mullo_epi16(high, high), round), FracBits);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(squares + i), _mm_packs_epi16(low, high));
+	}
+	saturated_scalar<std::int8_t, FracBits>(values + i, squares + i, count - i);
+}
+
+template<int FracBits>
+void saturated_sse2(const std::int16_t* values, std::int16_t* squares, std::size_t count) {
+	const __m128i round = _mm_set1_epi32(static_cast<int>(rounding<FracBits>));
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+		__m128i low = _mm_mullo_epi16(value, value);
+		__m128i high = _mm_mulhi_epi16(value, value);
+		__m128i first = _mm_srai_epi32(_mm_add_epi32(_mm_unpacklo_epi16(low, high), round), FracBits);
+		__m128i second = _mm_srai_epi32(_mm_add_epi32(_mm_unpackhi_epi16(low, high), round), FracBits);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(squares + i), _mm_packs_epi32(first, second));
+	}
+	saturated_scalar<std::int16_t, FracBits>(values + i, squares + i, count - i);
+}
+
+// SSE2 has no signed 32 x 32 -> 64 bit multiplication (pmuldq is SSE4.1)
+template<int FracBits>
+void saturated_sse2(const std::int32_t* values, std::int32_t* squares, std::size_t count) {
+	saturated_scalar<std::int32_t, FracBits>(values, squares, count);
+}
+
+template<int FracBits>
+CPU_DISPATCH_AVX2 void saturated_avx2(const std::int8_t* values, std::int8_t* squares, std::size_t count) {
+	const __m256i round = _mm256_set1_epi16(static_cast<short>(rounding<FracBits>));
+	std::size_t i = 0;
+	for (; i + 32 <= count; i += 32) {
+		__m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+		__m256i low = _mm256_srai_epi16(_mm256_unpacklo_epi8(value, value), 8);
+		__m256i high = _mm256_srai_epi16(_mm256_unpackhi_epi8(value, value), 8);
+		low = _mm256_srai_epi16(_mm256_add_epi16(_mm256_mullo_epi16(low, low), round), FracBits);
+		high = _mm256_srai_epi16(_mm256_add_epi16(_mm256_mullo_epi16(high, high), round), FracBits);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(squares + i), _mm256_packs_epi16(low, high));
+	}
+	saturated_scalar<std::int8_t, FracBits>(values + i, squares + i, count - i);
+}
+
+template<int FracBits>
+CPU_DISPATCH_AVX2 void saturated_avx2(const std::int16_t* values, std::int16_t* squares, std::size_t count) {
+	const __m256i round = _mm256_set1_epi32(static_cast<int>(rounding<FracBits>));
+	std::size_t i = 0;
+	for (; i + 16 <= count; i += 16) {
+		__m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+		__m256i low = _mm256_mullo_epi16(value, value);
+		__m256i high = _mm256_mulhi_epi16(value, value);
+		__m256i first = _mm256_srai_epi32(_mm256_add_epi32(_mm256_unpacklo_epi16(low, high), round), FracBits);
+		__m256i second = _mm256_srai_epi32(_mm256_add_epi32(_mm256_unpackhi_epi16(low, high), round), FracBits);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(squares + i), _mm256_packs_epi32(first, second));
+	}
+	saturated_scalar<std::int16_t, FracBits>(values + i, squares + i, count - i);
+}
+
+// int32 squares are 64-bit products of the even and the odd lanes, saturated and blended back together
+template<int FracBits>
+CPU_DISPATCH_AVX2 void saturated_avx2(const std::int32_t* values, std::int32_t* squares, std::size_t count) {
+	const __m256i round = _mm256_set1_epi64x(rounding<FracBits>);
+	const __m256i largest = _mm256_set1_epi64x(std::numeric_limits<std::int32_t>::max());
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+		__m256i odd_value = _mm256_srli_epi64(value, 32);
+		__m256i even = _mm256_srli_epi64(_mm256_add_epi64(_mm256_mul_epi32(value, value), round), FracBits);
+		__m256i odd = _mm256_srli_epi64(_mm256_add_epi64(_mm256_mul_epi32(odd_value, odd_value), round), FracBits);
+		even = _mm256_blendv_epi8(even, largest, _mm256_cmpgt_epi64(even, largest));
+		odd = _mm256_blendv_epi8(odd, largest, _mm256_cmpgt_epi64(odd, largest));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(squares + i), _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xaa));
+	}
+	saturated_scalar<std::int32_t, FracBits>(values + i, squares + i, count - i);
+}
+
+// the tails are one masked iteration; GCC 12 warns about the _mm512_undefined_epi32() which unmasked
+// AVX-512 intrinsics pass as their merge source
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+template<int FracBits>
+CPU_DISPATCH_AVX512 void saturated_avx512(const std::int8_t* values, std::int8_t* squares, std::size_t count) {
+	const __m512i round = _mm512_set1_epi16(static_cast<short>(rounding<FracBits>));
+	for (std::size_t i = 0; i < count; i += 64) {
+		__mmask64 mask = count - i >= 64 ? ~__mmask64{0} : (__mmask64{1} << (count - i)) - 1;
+		__m512i value = _mm512_maskz_loadu_epi8(mask, values + i);
+		__m512i low = _mm512_srai_epi16(_mm512_unpacklo_epi8(value, value), 8);
+		__m512i high = _mm512_srai_epi16(_mm512_unpackhi_epi8(value, value), 8);
+		low = _mm512_srai_epi16(_mm512_add_epi16(_mm512_mullo_epi16(low, low), round), FracBits);
+		high = _mm512_srai_epi16(_mm512_add_epi16(_mm512_mullo_epi16(high, high), round), FracBits);
+		_mm512_mask_storeu_epi8(squares + i, mask, _mm512_packs_epi16(low, high));
+	}
+}
+
+template<int FracBits>
+CPU_DISPATCH_AVX512 void saturated_avx512(const std::int16_t* values, std::int16_t* squares, std::size_t count) {
+	const __m512i round = _mm512_set1_epi32(static_cast<int>(rounding<FracBits>));
+	for (std::size_t i = 0; i < count; i += 32) {
+		__mmask32 mask = count - i >= 32 ? ~__mmask32{0} : static_cast<__mmask32>((std::uint64_t{1} << (count - i)) - 1);
+		__m512i value = _mm512_maskz_loadu_epi16(mask, values + i);
+		__m512i low = _mm512_mullo_epi16(value, value);
+		__m512i high = _mm512_mulhi_epi16(value, value);
+		__m512i first = _mm512_srai_epi32(_mm512_add_epi32(_mm512_unpacklo_epi16(low, high), round), FracBits);
+		__m512i second = _mm512_srai_epi32(_mm512_add_epi32(_mm512_unpackhi_epi16(low, high), round), FracBits);
+		_mm512_mask_storeu_epi16(squares + i, mask, _mm512_packs_epi32(first, second));
+	}
+}
+
+template<int FracBits>
+CPU_DISPATCH_AVX512 void saturated_avx512(const std::int32_t* values, std::int32_t* squares, std::size_t count) {
+	const __m512i round = _mm512_set1_epi64(rounding<FracBits>);
+	const __m512i largest = _mm512_set1_epi64(std::numeric_limits<std::int32_t>::max());
+	for (std::size_t i = 0; i < count; i += 16) {
+		__mmask16 mask = count - i >= 16 ? 0xffff : static_cast<__mmask16>((1u << (count - i)) - 1);
+		__m512i value = _mm512_maskz_loadu_epi32(mask, values + i);
+		__m512i odd_value = _mm512_srli_epi64(value, 32);
+		__m512i even = _mm512_srli_epi64(_mm512_add_epi64(_mm512_mul_epi32(value, value), round), FracBits);
+		__m512i odd = _mm512_srli_epi64(_mm512_add_epi64(_mm512_mul_epi32(odd_value, odd_value), round), FracBits);
+		even = _mm512_min_epu64(even, largest);
+		odd = _mm512_min_epu64(odd, largest);
+		_mm512_mask_storeu_epi32(squares + i, mask, _mm512_mask_blend_epi32(0xaaaa, even, _mm512_slli_epi64(odd, 32)));
+	}
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+template<typename T, int FracBits>
+cpu_dispatch::Kernel<void(const T*, T*, std::size_t)>& saturated_kernel() {
+	static cpu_dispatch::Kernel<void(const T*, T*, std::size_t)> kernel{saturated_sse2<FracBits>, saturated_avx2<FracBits>,
+		saturated_avx512<FracBits>};
+	return kernel;
+}
+
+#else
+
+template<typename T>
+cpu_dispatch::Kernel<void(const T*, T*, std::size_t)>& kernel() {
+	static cpu_dispatch::Kernel<void(const T*, T*, std::size_t)> kernel{square_scalar<T>, nullptr, nullptr};
+	return kernel;
+}
+
+template<>
+cpu_dispatch::Kernel<void(const int*, int*, std::size_t)>& kernel<int>() {
+	static cpu_dispatch::Kernel<void(const int*, int*, std::size_t)> kernel{square_scalar_wrap, nullptr, nullptr};
+	return kernel;
+}
+
+template<typename T, int FracBits>
+cpu_dispatch::Kernel<void(const T*, T*, std::size_t)>& saturated_kernel() {
+	static cpu_dispatch::Kernel<void(const T*, T*, std::size_t)> kernel{saturated_scalar<T, FracBits>, nullptr, nullptr};
+	return kernel;
+}
+
+#endif
+
+}
+
+template<typename T>
+void square(const T* values, T* squares, std::size_t count) {
+	kernel<T>()(values, squares, count);
+}
+
+template void square<int>(const int* values, int* squares, std::size_t count);
+template void square<double>(const double* values, double* squares, std::size_t count);
+
+template<typename T>
+void square_sat(const T* values, T* squares, std::size_t count) {
+	saturated_kernel<T, 0>()(values, squares, count);
+}
+
+template<typename T, int FracBits>
+void square_q(const T* values, T* squares, std::size_t count) {
+	saturated_kernel<T, FracBits>()(values, squares, count);
+}
+
+template void square_sat<std::int8_t>(const std::int8_t* values, std::int8_t* squares, std::size_t count);
+template void square_sat<std::int16_t>(const std::int16_t* values, std::int16_t* squares, std::size_t count);
+template void square_sat<std::int32_t>(const std::int32_t* values, std::int32_t* squares, std::size_t count);
+
+template void square_q<std::int8_t, 7>(const std::int8_t* values, std::int8_t* squares, std::size_t count);
+template void square_q<std::int16_t, 8>(const std::int16_t* values, std::int16_t* squares, std::size_t count);
+template void square_q<std::int16_t, 15>(const std::int16_t* values, std::int16_t* squares, std::size_t count);
+template void square_q<std::int32_t, 31>(const std::int32_t* values, std::int32_t* squares, std::size_t count);
@@ -8,6 +8,14 @@
 #include "func.h"
 
 #include "../doctest.h"
+#include "../perf/check_all.h"
+#include "../perf/cpu_dispatch.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
 
 
 TEST_CASE("[template] - template function") {
@@ -17,3 +25,150 @@ TEST_CASE("[template] - template function") {
 	CHECK(square<double>(0.5) == 0.25); // power of 2 - can compare exactly
 	CHECK(square<double>(0.1) == doctest::Approx(0.01));
 }
+
+TEST_CASE("[template] - squares of arrays on every instruction set") {
+	std::vector<int> values(1000);
+	std::vector<double> real_values(values.size());
+	for (std::size_t i = 0; i < values.size(); i++) {
+		values[i] = static_cast<int>(i * 2654435761u); // large ones wrap around
+		real_values[i] = 0.5 * static_cast<double>(values[i]);
+	}
+	for (cpu_dispatch::Isa isa: {cpu_dispatch::Isa::baseline, cpu_dispatch::Isa::avx2, cpu_dispatch::Isa::avx512}) {
+		if (!cpu_dispatch::supported(isa)) {
+			continue;
+		}
+		CAPTURE(cpu_dispatch::name(isa));
+		cpu_dispatch::ForceScope scope{isa};
+		for (std::size_t count: {0, 1, 3, 7, 8, 15, 16, 17, 33, 1000}) {
+			CAPTURE(count);
+			std::size_t offset = count < values.size() ? 1 : 0; // unaligned
+			std::vector<int> squares(count, -1);
+			square(values.data() + offset, squares.data(), count);
+			bool exact = true;
+			for (std::size_t i = 0; i < count; i++) {
+				std::uint32_t value = static_cast<std::uint32_t>(values[offset + i]);
+				exact = exact && squares[i] == static_cast<int>(value * value);
+			}
+			CHECK(exact);
+
+			std::vector<double> real_squares(real_values.begin() + offset, real_values.begin() + offset + count);
+			square(real_squares.data(), real_squares.data(), count); // in place
+			exact = true;
+			for (std::size_t i = 0; i < count; i++) {
+				exact = exact && real_squares[i] == square(real_values[offset + i]);
+			}
+			CHECK(exact);
+		}
+	}
+}
+
+namespace {
+
+/**
+ * \brief Every value of T, each one at a few positions so that vector bodies and tails see all of them
+ */
+template<typename T>
+std::vector<T> every_value() {
+	std::vector<T> values;
+	for (int offset: {0, 5, 13}) {
+		for (long long i = 0; i <= std::numeric_limits<T>::max() - std::numeric_limits<T>::min(); i++) {
+			values.push_back(static_cast<T>(std::numeric_limits<T>::min() + (i + offset) % (1LL << (8 * sizeof(T)))));
+		}
+	}
+	return values;
+}
+
+long long saturated(long long value, long long largest) {
+	return value > largest ? largest : value;
+}
+
+/**
+ * \brief The span version on every instruction set, at different lengths and misalignments, against the scalar one
+ */
+template<typename T, typename Scalar>
+void check_spans(const std::vector<T>& values, void (*span)(const T*, T*, std::size_t), Scalar scalar) {
+	std::vector<T> expected(values.size());
+	for (std::size_t i = 0; i < values.size(); i++) {
+		expected[i] = scalar(values[i]);
+	}
+	for (cpu_dispatch::Isa isa: {cpu_dispatch::Isa::baseline, cpu_dispatch::Isa::avx2, cpu_dispatch::Isa::avx512}) {
+		if (!cpu_dispatch::supported(isa)) {
+			continue;
+		}
+		CAPTURE(cpu_dispatch::name(isa));
+		cpu_dispatch::ForceScope scope{isa};
+		for (std::size_t offset: {0, 1, 7}) {
+			CAPTURE(offset);
+			std::vector<T> squares(values.size() - offset);
+			span(values.data() + offset, squares.data(), squares.size());
+			CHECK(std::equal(squares.begin(), squares.end(), expected.begin() + offset));
+			for (std::size_t count = 0; count <= 130; count++) {
+				std::vector<T> short_squares(count + 1, 42);
+				span(values.data() + offset, short_squares.data(), count);
+				CHECK(std::equal(short_squares.begin(), short_squares.begin() + count, expected.begin() + offset));
+				CHECK(short_squares[count] == 42); // not written
+			}
+		}
+	}
+}
+
+}
+
+TEST_CASE("[template] - saturating squares of every int8 and int16") {
+	std::vector<std::int8_t> bytes = every_value<std::int8_t>();
+	std::vector<std::int16_t> words = every_value<std::int16_t>();
+	REQUIRE(words.size() == 3 * 65536);
+
+	CHECK_ALL(bytes, [](std::int8_t value) { return square_sat(value) == saturated(value * value, 127); });
+	CHECK_ALL(words, [](std::int16_t value) { return square_sat(value) == saturated(value * value, 32767); });
+	CHECK(square_sat<std::int8_t>(-128) == 127);
+	CHECK(square_sat<std::int8_t>(11) == 121);
+	CHECK(square_sat<std::int16_t>(181) == 32761);
+	CHECK(square_sat<std::int16_t>(182) == 32767);
+
+	check_spans(bytes, square_sat<std::int8_t>, [](std::int8_t value) { return square_sat(value); });
+	check_spans(words, square_sat<std::int16_t>, [](std::int16_t value) { return square_sat(value); });
+}
+
+TEST_CASE("[template] - fixed-point squares of every Q7, Q8.8 and Q15") {
+	std::vector<std::int8_t> bytes = every_value<std::int8_t>();
+	std::vector<std::int16_t> words = every_value<std::int16_t>();
+
+	// rounded half up: floor(value² / 2^bits + 1/2)
+	CHECK_ALL(bytes, [](std::int8_t value) { return square_q<std::int8_t, 7>(value) == saturated((value * value + 64) / 128, 127); });
+	CHECK_ALL(words, [](std::int16_t value) { return square_q<std::int16_t, 8>(value) == saturated((value * value + 128) / 256, 32767); });
+	CHECK_ALL(words, [](std::int16_t value) { return square_q<std::int16_t, 15>(value) == saturated((value * value + 16384) / 32768, 32767); });
+	CHECK(square_q<std::int16_t, 15>(16384) == 8192);		// 0.5² = 0.25
+	CHECK(square_q<std::int16_t, 15>(-32768) == 32767);		// (-1)² saturates to 1 - 2^-15
+	CHECK(square_q<std::int16_t, 8>(3 * 256 / 2) == 576);	// 1.5² = 2.25
+	CHECK(square_q<std::int8_t, 7>(1) == 0);
+	CHECK(square_q<std::int8_t, 7>(8) == 1);				// 0.5 ulp rounds up
+
+	check_spans(bytes, square_q<std::int8_t, 7>, [](std::int8_t value) { return square_q<std::int8_t, 7>(value); });
+	check_spans(words, square_q<std::int16_t, 8>, [](std::int16_t value) { return square_q<std::int16_t, 8>(value); });
+	check_spans(words, square_q<std::int16_t, 15>, [](std::int16_t value) { return square_q<std::int16_t, 15>(value); });
+}
+
+TEST_CASE("[template] - saturating and Q31 squares of int32") {
+	std::mt19937 random{20261018};
+	std::uniform_int_distribution<std::int32_t> any{std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max()};
+	std::uniform_int_distribution<std::int32_t> near_limit{-46341, 46341};
+	std::vector<std::int32_t> values{std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max(),
+		-46341, -46340, 0, 1, -1, 46340, 46341, 1 << 30, -(1 << 15), 1 << 15};
+	for (int i = 0; i < 20000; i++) {
+		values.push_back(i % 2 ? any(random) : near_limit(random));
+	}
+	const long long largest = std::numeric_limits<std::int32_t>::max();
+
+	CHECK_ALL(values, [&](std::int32_t value) { return square_sat(value) == saturated(1LL * value * value, largest); });
+	CHECK_ALL(values, [&](std::int32_t value) {
+		return square_q<std::int32_t, 31>(value) == saturated((1LL * value * value + (1LL << 30)) >> 31, largest);
+	});
+	CHECK(square_sat(46340) == 2147395600);
+	CHECK(square_sat(-46341) == largest);
+	CHECK(square_q<std::int32_t, 31>(1 << 30) == 1 << 29);				// 0.5² = 0.25
+	CHECK(square_q<std::int32_t, 31>(std::numeric_limits<std::int32_t>::min()) == largest);
+
+	check_spans(values, square_sat<std::int32_t>, [](std::int32_t value) { return square_sat(value); });
+	check_spans(values, square_q<std::int32_t, 31>, [](std::int32_t value) { return square_q<std::int32_t, 31>(value); });
+}
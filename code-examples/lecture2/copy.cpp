@@ -5,6 +5,8 @@
  *      Author: KZ
  */
 
+#include "../commands.h"
+
 #include <iostream>
 #include <vector>
 using namespace std;
@@ -86,6 +88,9 @@ int main(int argc, char** argv) {
 	return 0;
 }
 
+static commands::Registrar registrar{"lecture2_08_09_20", commands::Kind::example, main,
+		"lecture 2: references, shallow and deep copies"};
+
 }
 
 
@@ -0,0 +1,140 @@
+/*
+ * intrusive_list.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "intrusive_list.h"
+#include "../perf/alloc_counter.h"
+
+#include "../doctest.h"
+
+#include <sstream>
+#include <stdexcept>
+
+namespace test_intrusive_list {
+
+struct RunQueue;
+struct AllTasks;
+
+struct Task: IntrusiveListHook<RunQueue>, IntrusiveListHook<AllTasks> {
+	int id;
+	Task(int id): id{id} {}
+};
+
+std::ostream& operator<<(std::ostream& out, const Task& task) {
+	return out<<task.id;
+}
+
+}
+
+using test_intrusive_list::Task;
+using test_intrusive_list::RunQueue;
+using test_intrusive_list::AllTasks;
+
+TEST_CASE("[intrusive list] - linking and unlinking") {
+	Task a{1}, b{2}, c{3};
+	IntrusiveList<Task, RunQueue> queue;
+	CHECK(queue.size() == 0);
+	CHECK(queue.empty());
+	CHECK(queue.begin() == queue.end());
+	CHECK(queue.pop_front() == nullptr);
+
+	auto before = alloc_counter::total();
+	queue.append(a);
+	queue.append(c);
+	queue.insert_before(c, b);
+	CHECK((alloc_counter::total() - before).allocations == 0);
+
+	CHECK(queue.size() == 3);
+	CHECK(&queue.front() == &a);
+	CHECK(&queue.back() == &c);
+	CHECK(queue.contains(b));
+	{
+		std::stringstream s_out;
+		s_out<<queue;
+		CHECK(s_out.str() == "[ 1 2 3 ]");
+	}
+
+	SUBCASE("unlink from the object itself") {
+		static_cast<IntrusiveListHook<RunQueue>&>(b).unlink();
+		CHECK(queue.size() == 2);
+		CHECK_FALSE(queue.contains(b));
+		std::stringstream s_out;
+		s_out<<queue;
+		CHECK(s_out.str() == "[ 1 3 ]");
+	}
+	SUBCASE("pop front and prepend") {
+		CHECK(queue.pop_front() == &a);
+		CHECK(queue.size() == 2);
+		queue.prepend(a);
+		CHECK(&queue.front() == &a);
+		CHECK(queue.size() == 3);
+	}
+	SUBCASE("linking twice is an error") {
+		CHECK_THROWS_AS(queue.append(a), std::invalid_argument);
+		CHECK(queue.size() == 3);
+	}
+	SUBCASE("destroyed object unlinks itself") {
+		{
+			Task temporary{4};
+			queue.append(temporary);
+			CHECK(queue.size() == 4);
+		}
+		CHECK(queue.size() == 3);
+		CHECK(&queue.back() == &c);
+	}
+	SUBCASE("iterating backwards") {
+		auto it = queue.end();
+		--it;
+		CHECK(it->id == 3);
+		--it;
+		CHECK((*it).id == 2);
+	}
+	SUBCASE("clear only unlinks") {
+		queue.clear();
+		CHECK(queue.empty());
+		CHECK_FALSE(queue.contains(a));
+		CHECK(a.id == 1);
+		queue.append(a);
+		CHECK(queue.size() == 1);
+	}
+}
+
+TEST_CASE("[intrusive list] - object in several lists") {
+	Task a{1}, b{2};
+	IntrusiveList<Task, RunQueue> run_queue;
+	IntrusiveList<Task, AllTasks> all_tasks;
+	IntrusiveList<Task, RunQueue> wait_queue;
+
+	all_tasks.append(a);
+	all_tasks.append(b);
+	run_queue.append(b);
+	run_queue.append(a);
+
+	CHECK(&all_tasks.front() == &a);
+	CHECK(&run_queue.front() == &b);
+
+	// moving between lists with the same hook
+	run_queue.remove(a);
+	wait_queue.append(a);
+	CHECK(run_queue.size() == 1);
+	CHECK(wait_queue.contains(a));
+	CHECK_FALSE(run_queue.contains(a));
+	CHECK(all_tasks.size() == 2); // other hook is not affected
+
+	SUBCASE("list destructor unlinks objects") {
+		{
+			IntrusiveList<Task, RunQueue> temporary;
+			wait_queue.remove(a);
+			temporary.append(a);
+		}
+		CHECK_FALSE(static_cast<IntrusiveListHook<RunQueue>&>(a).is_linked());
+	}
+	SUBCASE("copies are not linked") {
+		Task copy = a;
+		CHECK_FALSE(static_cast<IntrusiveListHook<AllTasks>&>(copy).is_linked());
+		CHECK(all_tasks.size() == 2);
+	}
+}
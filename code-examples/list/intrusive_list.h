@@ -0,0 +1,284 @@
+/*
+ * intrusive_list.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_LIST_INTRUSIVE_LIST_H_
+#define CODE_EXAMPLES_LIST_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+
+template<typename Tag>
+struct IntrusiveListHead;
+
+template<typename T, typename Tag>
+class IntrusiveList;
+
+/**
+ * \brief Links of one intrusive list embedded into an object
+ *
+ * A type which should be stored in intrusive lists derives from one hook per list it can be in,
+ * hooks are told apart (named) by the Tag type:
+ * \code
+ * struct Task: IntrusiveListHook<struct RunQueue>, IntrusiveListHook<struct AllTasks> { ... };
+ * IntrusiveList<Task, RunQueue> run_queue;
+ * IntrusiveList<Task, AllTasks> all_tasks;
+ * \endcode
+ * Unlike ListNode, the hook doesn't own the object and linking never allocates.
+ * A hook is in at most one list at a time, it unlinks itself when destroyed.
+ * \see IntrusiveList
+ */
+template<typename Tag = void>
+class IntrusiveListHook {
+private:
+	IntrusiveListHook* prev = nullptr;		/**< Previous hook, the sentinel of the list for the first one */
+	IntrusiveListHook* next = nullptr;		/**< Next hook, the sentinel of the list for the last one */
+	IntrusiveListHead<Tag>* head = nullptr;	/**< List containing this hook, nullptr if not linked */
+
+	template<typename T, typename ListTag>
+	friend class IntrusiveList;
+	friend struct IntrusiveListHead<Tag>;
+public:
+	IntrusiveListHook() = default;
+
+	/**
+	 * \brief Copies of an object are not linked anywhere
+	 */
+	IntrusiveListHook(const IntrusiveListHook&) {}
+
+	/**
+	 * \brief Assignment keeps the links of the target
+	 */
+	IntrusiveListHook& operator=(const IntrusiveListHook&) {
+		return *this;
+	}
+
+	~IntrusiveListHook() {
+		unlink();
+	}
+
+	bool is_linked() const {
+		return head != nullptr;
+	}
+
+	/**
+	 * \brief Remove the object from the list containing it (if any)
+	 *
+	 * Complexity is O(1), the list doesn't have to be known.
+	 * \post is_linked() is false, size of the list is decreased by 1
+	 */
+	void unlink();
+};
+
+/**
+ * \brief Sentinel and size of an intrusive list
+ *
+ * Depends only on the Tag (not on the object type), so hooks can update the size of their list when unlinked.
+ */
+template<typename Tag>
+struct IntrusiveListHead {
+	IntrusiveListHook<Tag> sentinel;	/**< Circular list: sentinel.next is the first hook, sentinel.prev is the last */
+	std::size_t _size = 0;
+
+	IntrusiveListHead() {
+		sentinel.prev = sentinel.next = &sentinel;
+	}
+};
+
+template<typename Tag>
+void IntrusiveListHook<Tag>::unlink() {
+	if (!head) {
+		return;
+	}
+	prev->next = next;
+	next->prev = prev;
+	head->_size--;
+	prev = next = nullptr;
+	head = nullptr;
+}
+
+/**
+ * \brief Intrusive doubly linked list
+ *
+ * Links objects through IntrusiveListHook<Tag> base of T instead of creating nodes (as DoublyLinkedList does).
+ * The list doesn't own the objects: they must outlive their membership, and clear() only unlinks them.
+ * All operations are O(1) except clear() and operator<<.
+ * Lists can't be copied or moved - hooks point to the sentinel inside the list.
+ * \see DoublyLinkedList
+ */
+template<typename T, typename Tag = void>
+class IntrusiveList {
+private:
+	using Hook = IntrusiveListHook<Tag>;
+
+	IntrusiveListHead<Tag> head;
+
+	static T& object(Hook* hook) {
+		return *static_cast<T*>(hook);
+	}
+
+	static Hook& hook(T& value) {
+		return static_cast<Hook&>(value);
+	}
+
+	void link_before(Hook& position, T& value) {
+		Hook& new_hook = hook(value);
+		if (new_hook.head) {
+			throw std::invalid_argument{"value is already linked into a list"};
+		}
+		new_hook.prev = position.prev;
+		new_hook.next = &position;
+		position.prev->next = &new_hook;
+		position.prev = &new_hook;
+		new_hook.head = &head;
+		head._size++;
+	}
+public:
+	/**
+	 * \brief Bidirectional iterator over the objects in the list
+	 */
+	class iterator {
+	private:
+		Hook* current;
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = T*;
+		using reference = T&;
+
+		explicit iterator(Hook* current): current{current} {}
+
+		T& operator*() const { return object(current); }
+		T* operator->() const { return &object(current); }
+		iterator& operator++() { current = current->next; return *this; }
+		iterator operator++(int) { iterator result = *this; ++*this; return result; }
+		iterator& operator--() { current = current->prev; return *this; }
+		iterator operator--(int) { iterator result = *this; --*this; return result; }
+		bool operator==(const iterator& other) const { return current == other.current; }
+		bool operator!=(const iterator& other) const { return current != other.current; }
+	};
+
+	IntrusiveList() = default;
+	IntrusiveList(const IntrusiveList&) = delete;
+	IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+	~IntrusiveList() {
+		this->clear();
+	}
+
+	/**
+	 * \brief Link value at the end of this list
+	 *
+	 * \throw std::invalid_argument if value is already linked into a list with the same Tag
+	 * \post List size is increased by 1
+	 */
+	void append(T& value) {
+		link_before(head.sentinel, value);
+	}
+
+	/**
+	 * \brief Link value at the beginning of this list
+	 *
+	 * \throw std::invalid_argument if value is already linked into a list with the same Tag
+	 */
+	void prepend(T& value) {
+		link_before(*head.sentinel.next, value);
+	}
+
+	/**
+	 * \brief Link value just before position (which must be in this list)
+	 *
+	 * \throw std::invalid_argument if value is already linked into a list with the same Tag
+	 */
+	void insert_before(T& position, T& value) {
+		link_before(hook(position), value);
+	}
+
+	/**
+	 * \brief Unlink value, which must be in this list
+	 *
+	 * Same as calling unlink() of the hook.
+	 */
+	void remove(T& value) {
+		hook(value).unlink();
+	}
+
+	/**
+	 * \brief Unlink and return the first object
+	 *
+	 * \return nullptr if the list is empty
+	 */
+	T* pop_front() {
+		if (empty()) {
+			return nullptr;
+		}
+		Hook* first = head.sentinel.next;
+		first->unlink();
+		return &object(first);
+	}
+
+	T& front() {
+		if (empty()) {
+			throw std::out_of_range{"front of empty list"};
+		}
+		return object(head.sentinel.next);
+	}
+
+	T& back() {
+		if (empty()) {
+			throw std::out_of_range{"back of empty list"};
+		}
+		return object(head.sentinel.prev);
+	}
+
+	/**
+	 * \brief Whether value is linked into this list (not into another list with the same Tag)
+	 */
+	bool contains(const T& value) const {
+		return static_cast<const Hook&>(value).head == &head;
+	}
+
+	/**
+	 * \brief Unlink all objects, the objects themselves are not changed
+	 *
+	 * Complexity is O(n)
+	 */
+	void clear() {
+		while (!empty()) {
+			head.sentinel.next->unlink();
+		}
+	}
+
+	std::size_t size() const {
+		return head._size;
+	}
+
+	bool empty() const {
+		return head._size == 0;
+	}
+
+	iterator begin() {
+		return iterator{head.sentinel.next};
+	}
+
+	iterator end() {
+		return iterator{&head.sentinel};
+	}
+
+	friend std::ostream& operator<<(std::ostream& out, IntrusiveList<T, Tag>& list) {
+		out<<"[ ";
+		for (T& value: list) {
+			out << value << " ";
+		}
+		out<<"]";
+		return out;
+	}
+};
+
+#endif /* CODE_EXAMPLES_LIST_INTRUSIVE_LIST_H_ */
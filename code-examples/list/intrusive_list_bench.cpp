@@ -0,0 +1,109 @@
+/*
+ * intrusive_list_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "intrusive_list.h"
+#include "list.h"
+#include "../perf/alloc_counter.h"
+#include "../commands.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace bench_intrusive_list {
+
+struct RunQueue;
+
+struct Task: IntrusiveListHook<RunQueue> {
+	int id;
+	long long runs = 0;
+	Task(int id): id{id} {}
+};
+
+/**
+ * \brief Scheduler step: run the first task, then requeue it or put it to sleep; wake one task regularly
+ *
+ * Queue is DoublyLinkedList<Task*> or IntrusiveList<Task, RunQueue>, the two differ only in how tasks are taken and put.
+ */
+template<typename Queue, typename Take, typename Put>
+double run_scheduler(Queue& run_queue, Queue& wait_queue, long steps, Take take, Put put) {
+	unsigned random = 12345;
+	auto begin = std::chrono::steady_clock::now();
+	for (long step = 0; step < steps; step++) {
+		random = random * 1103515245u + 12345u;
+		Task* task = take(run_queue);
+		if (!task) {
+			task = take(wait_queue);
+		}
+		task->runs++;
+		if ((random >> 16) % 8 == 0) {
+			put(wait_queue, task); // blocks
+		} else {
+			put(run_queue, task); // time slice is over
+		}
+		if (step % 8 == 0) {
+			Task* woken = take(wait_queue);
+			if (woken) {
+				put(run_queue, woken);
+			}
+		}
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - begin;
+	return elapsed.count() / steps;
+}
+
+// usage: bench_intrusive_list [tasks] [steps]
+int main(int argc, char** argv) {
+	int task_count = argc > 1 ? std::atoi(argv[1]) : 10000;
+	long steps = argc > 2 ? std::atol(argv[2]) : 10000000;
+
+	std::vector<Task> tasks;
+	tasks.reserve(task_count);
+	for (int i = 0; i < task_count; i++) {
+		tasks.emplace_back(i);
+	}
+
+	DoublyLinkedList<Task*> owning_run, owning_wait;
+	for (Task& task: tasks) {
+		owning_run.append(&task);
+	}
+	auto before = alloc_counter::total();
+	double owning_ns = run_scheduler(owning_run, owning_wait, steps,
+		[](DoublyLinkedList<Task*>& queue) -> Task* {
+			return queue.size() ? queue.pop_front() : nullptr;
+		},
+		[](DoublyLinkedList<Task*>& queue, Task* task) {
+			queue.append(task);
+		});
+	auto owning_allocations = alloc_counter::total() - before;
+
+	IntrusiveList<Task, RunQueue> intrusive_run, intrusive_wait;
+	for (Task& task: tasks) {
+		intrusive_run.append(task);
+	}
+	before = alloc_counter::total();
+	double intrusive_ns = run_scheduler(intrusive_run, intrusive_wait, steps,
+		[](IntrusiveList<Task, RunQueue>& queue) {
+			return queue.pop_front();
+		},
+		[](IntrusiveList<Task, RunQueue>& queue, Task* task) {
+			queue.append(*task);
+		});
+	auto intrusive_allocations = alloc_counter::total() - before;
+
+	std::cout<<"tasks="<<task_count<<" steps="<<steps<<std::endl;
+	std::cout<<"list\tns/step\tallocations/step"<<std::endl;
+	std::cout<<"DoublyLinkedList<Task*>\t"<<owning_ns<<"\t"<<double(owning_allocations.allocations) / steps<<std::endl;
+	std::cout<<"IntrusiveList<Task>\t"<<intrusive_ns<<"\t"<<double(intrusive_allocations.allocations) / steps<<std::endl;
+	return 0;
+}
+
+static commands::Registrar registrar{"bench_intrusive_list", commands::Kind::benchmark, main,
+		"intrusive vs owning list as a task queue", {"1000", "200000"}};
+
+}
@@ -5,145 +5,18 @@
  *      Author: KZ
  */
 
+#include "list.h"
+#include "../perf/alloc_counter.h"
+
 #include "../doctest.h"
+#include "../perf/alloc_check.h"
+#include "../perf/hw_report.h"
 
-#include <cstddef>
-#include <ostream>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
-
-/**
- * \brief A single node in doubly linked list
- *
- * A single node holding a value and pointers to the next and previous nodes.
- * Pointers can be empty (for first and last nodes).
- * \see DoublyLinkedList
- */
-template<typename T>
-struct ListNode {
-	T value;			/**< Value stored in this node */
-	ListNode<T>* prev;		/**< Pointer to the previous node in the list, can be empty (nullptr) for the first node */
-	ListNode<T>* next;		/**< Pointer to the next node in the list, can be empty (nullptr) for the last node */
-
-	/**
-	 * \brief ListNode constructor
-	 *
-	 * Value must be specified, previous and next pointers are optional.
-	 * Can specify only previous without next (useful for append)
-	 * \callergraph
-	 */
-	ListNode(T value, ListNode<T>* prev=nullptr, ListNode<T>* next=nullptr): value{value}, prev{prev}, next{next} {}
-};
-
-
-namespace test_doubly_linked_list {
-	void test_create_append_clear();
-}
-
-/**
- * \brief Doubly linked list
- *
- * Stores a sequence of values using nodes (ListNode objects) for each value linked with next and previous pointers,
- * See [Doubly Linked List](https://en.wikipedia.org/wiki/Doubly_linked_list "Wikipedia article on Doubly Linked List")
- */
-template<typename T>
-class DoublyLinkedList {
-private:
-	ListNode<T>* begin;
-	ListNode<T>* end;
-	std::size_t _size;
-public:
-
-	DoublyLinkedList(): begin{nullptr}, end{nullptr}, _size{0} {}
-
-	~DoublyLinkedList() {
-		this->clear();
-	}
-
-	/**
-	 * \brief Append value to the end of this list
-	 *
-	 * Creates a new node containing this value, inserts it at the end of list.
-	 *
-	 * \param value a value to be appended
-	 * \post List size is increased by 1
-	 * \callgraph
-	 */
-	void append(T value) {
-		auto new_node = new ListNode<T>{value};
-		if (begin == nullptr) {
-			begin = end = new_node;
-		} else {
-			new_node->prev = end;
-			end->next = new_node;
-			end = new_node;
-		}
-		_size++;
-	}
-
-	void clear() {
-		ListNode<T>* current = begin;
-		while(current) {
-			ListNode<T>* to_delete = current;
-			current = current->next;
-			delete to_delete;
-		}
-		begin = end = nullptr;
-		_size = 0;
-	}
-
-	/**
-	 * \brief Access items by index
-	 *
-	 * Complexity is O(n)
-	 * \param index zero-based index of item to get
-	 * \throw std::out_of_range if index is too large (greater or equals to list size)
-	 * \return value of item
-	 */
-	int operator[](std::size_t index) {
-		ListNode<T>* current = begin;
-		std::size_t cur_index = 0;
-		while(current) {
-			if (cur_index == index) {
-				return current->value;
-			}
-			current = current->next;
-			cur_index++;
-		}
-		throw std::out_of_range{"index="+std::to_string(index)+" larger than list size="+std::to_string(_size)};
-	}
-
-	std::size_t size() {
-		return _size;
-	}
-
-	std::size_t size_naive() {
-		std::size_t result = 0;
-		ListNode<T>* current = begin;
-		while(current) {
-			result++;
-			current = current->next;
-		}
-		return result;
-	}
-
-	friend std::ostream& operator<<(std::ostream& out, const DoublyLinkedList<T>& list) {
-		ListNode<T>* current = list.begin; //can also use auto current; or auto* current;
-		out<<"[ ";
-		while(current) {
-			out << current->value << " ";
-			current = current->next;
-		}
-		out<<"]";
-		return out;
-	}
-
-	friend void test_doubly_linked_list::test_create_append_clear();
-};
-
-
-
+#include <string>
+#include <vector>
 
 TEST_CASE("[list] - creating list nodes") {
 	ListNode<int> node{123};
@@ -169,27 +42,27 @@ TEST_CASE("[list] - creating list nodes") {
 namespace test_doubly_linked_list {
 	void test_create_append_clear() {
 		DoublyLinkedList<int> list;
-			CHECK(list.begin == nullptr);
-			CHECK(list.end == nullptr);
+			CHECK(list.first == nullptr);
+			CHECK(list.last == nullptr);
 			CHECK(list.size() == 0);
 
 			SUBCASE("append element") {
 				list.append(123);
-				CHECK(list.end == list.begin);
-				CHECK(list.begin->value == 123);
-				CHECK(list.begin->prev == nullptr);
-				CHECK(list.begin->next == nullptr);
+				CHECK(list.last == list.first);
+				CHECK(list.first->value == 123);
+				CHECK(list.first->prev == nullptr);
+				CHECK(list.first->next == nullptr);
 				CHECK(list.size() == 1);
 
 				list.append(456);
-				CHECK(list.end != list.begin);
-				CHECK(list.begin->value == 123);
-				CHECK(list.begin->prev == nullptr);
-				CHECK(list.begin->next == list.end);
+				CHECK(list.last != list.first);
+				CHECK(list.first->value == 123);
+				CHECK(list.first->prev == nullptr);
+				CHECK(list.first->next == list.last);
 
-				CHECK(list.end->value == 456);
-				CHECK(list.end->prev == list.begin);
-				CHECK(list.end->next == nullptr);
+				CHECK(list.last->value == 456);
+				CHECK(list.last->prev == list.first);
+				CHECK(list.last->next == nullptr);
 
 				CHECK(list.size() == 2);
 
@@ -201,6 +74,7 @@ namespace test_doubly_linked_list {
 
 				CHECK(list[0]==123);
 				CHECK(list[1]==456);
+				REQUIRE_NO_ALLOC(list[1]); // a walk over the nodes, only the out of range message allocates
 				try {
 					int result = list[2];
 					CHECK(result); // not called
@@ -210,6 +84,18 @@ namespace test_doubly_linked_list {
 
 				CHECK_THROWS_WITH_AS(list[2],"index=2 larger than list size=2",std::out_of_range);
 
+				SUBCASE("pop front") {
+					CHECK(list.pop_front()==123);
+					CHECK(list.size()==1);
+					CHECK(list.first == list.last);
+					CHECK(list.first->prev == nullptr);
+					CHECK(list.pop_front()==456);
+					CHECK(list.size()==0);
+					CHECK(list.first == nullptr);
+					CHECK(list.last == nullptr);
+					CHECK_THROWS_WITH_AS(list.pop_front(),"pop_front from empty list",std::out_of_range);
+				}
+
 				SUBCASE("clear list") {
 					list.clear();
 					CHECK(list.size()==0);
@@ -228,3 +114,53 @@ TEST_CASE("[list] - creating doubly-linked list") {
 
 
 
+TEST_CASE("[list] - indexed access walks from the first node") {
+	// list[i] visits i + 1 nodes: with --hw-report the misses are reported per visited node
+	const long long n = 2000;
+	DoublyLinkedList<int> list;
+	for (int i = 0; i < n; i++) {
+		list.append(i);
+	}
+	long long sum = 0;
+	for (int i = 0; i < n; i++) {
+		sum += list[i];
+	}
+	hw_report::set_elements(n * (n + 1) / 2);
+	CHECK(sum == n * (n - 1) / 2);
+	CHECK_THROWS_AS(list[n], std::out_of_range);
+}
+
+TEST_CASE("[list] - export to arrays") {
+	DoublyLinkedList<std::string> list;
+	CHECK(list.to_vector().empty());
+	for (int i = 0; i < 5; i++) {
+		list.append(std::to_string(i));
+	}
+
+	std::vector<std::string> values = list.to_vector();
+	CHECK(values == std::vector<std::string>{"0", "1", "2", "3", "4"});
+
+	DoublyLinkedList<int> numbers;
+	for (int i = 0; i < 1000; i++) {
+		numbers.append(i);
+	}
+	auto before = alloc_counter::total();
+	std::vector<int> copied = numbers.to_vector();
+	CHECK((alloc_counter::total() - before).allocations == 1); // presized, no reallocations
+	CHECK(copied.size() == 1000);
+	CHECK(copied[999] == 999);
+
+	std::string array[3];
+	CHECK(list.copy_to(array, 3) == 3);
+	CHECK(array[2] == "2");
+
+	std::vector<std::string> larger(8, "x");
+	CHECK(list.copy_to(larger.data(), larger.size()) == 5);
+	CHECK(larger[4] == "4");
+	CHECK(larger[5] == "x");
+
+#if __cplusplus >= 202002L
+	CHECK(list.copy_to(std::span<std::string>{larger}.subspan(6)) == 2);
+	CHECK(larger[7] == "1");
+#endif
+}
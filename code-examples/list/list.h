@@ -0,0 +1,334 @@
+/*
+ * list.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_LIST_LIST_H_
+#define CODE_EXAMPLES_LIST_LIST_H_
+
+#include "../perf/trace.h"
+
+#include <cstddef>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+/**
+ * \brief A single node in doubly linked list
+ *
+ * A single node holding a value and pointers to the next and previous nodes.
+ * Pointers can be empty (for first and last nodes).
+ * \see DoublyLinkedList
+ */
+template<typename T>
+struct ListNode {
+	T value;			/**< Value stored in this node */
+	ListNode<T>* prev;		/**< Pointer to the previous node in the list, can be empty (nullptr) for the first node */
+	ListNode<T>* next;		/**< Pointer to the next node in the list, can be empty (nullptr) for the last node */
+
+	/**
+	 * \brief ListNode constructor
+	 *
+	 * Value must be specified, previous and next pointers are optional.
+	 * Can specify only previous without next (useful for append)
+	 * \callergraph
+	 */
+	ListNode(T value, ListNode<T>* prev=nullptr, ListNode<T>* next=nullptr): value{value}, prev{prev}, next{next} {}
+};
+
+
+namespace test_doubly_linked_list {
+	void test_create_append_clear();
+}
+
+/**
+ * \brief Doubly linked list
+ *
+ * Stores a sequence of values using nodes (ListNode objects) for each value linked with next and previous pointers,
+ * See [Doubly Linked List](https://en.wikipedia.org/wiki/Doubly_linked_list "Wikipedia article on Doubly Linked List")
+ */
+template<typename T>
+class DoublyLinkedList {
+private:
+	ListNode<T>* first;
+	ListNode<T>* last;
+	std::size_t _size;
+public:
+
+	DoublyLinkedList(): first{nullptr}, last{nullptr}, _size{0} {}
+
+	~DoublyLinkedList() {
+		this->clear();
+	}
+
+	/**
+	 * \brief Append value to the end of this list
+	 *
+	 * Creates a new node containing this value, inserts it at the end of list.
+	 *
+	 * \param value a value to be appended
+	 * \post List size is increased by 1
+	 * \callgraph
+	 */
+	void append(T value) {
+		TRACE_SCOPE("DoublyLinkedList::append");
+		auto new_node = new ListNode<T>{value};
+		if (first == nullptr) {
+			first = last = new_node;
+		} else {
+			new_node->prev = last;
+			last->next = new_node;
+			last = new_node;
+		}
+		_size++;
+	}
+
+	/**
+	 * \brief Remove the first value of this list
+	 *
+	 * Complexity is O(1)
+	 * \throw std::out_of_range if the list is empty
+	 * \return removed value
+	 * \post List size is decreased by 1
+	 */
+	T pop_front() {
+		TRACE_SCOPE("DoublyLinkedList::pop_front");
+		if (first == nullptr) {
+			throw std::out_of_range{"pop_front from empty list"};
+		}
+		ListNode<T>* to_delete = first;
+		T value = to_delete->value;
+		first = first->next;
+		if (first) {
+			first->prev = nullptr;
+		} else {
+			last = nullptr;
+		}
+		delete to_delete;
+		_size--;
+		return value;
+	}
+
+	void clear() {
+		TRACE_SCOPE("DoublyLinkedList::clear");
+		ListNode<T>* current = first;
+		while(current) {
+			ListNode<T>* to_delete = current;
+			current = current->next;
+			delete to_delete;
+		}
+		first = last = nullptr;
+		_size = 0;
+	}
+
+	/**
+	 * \brief Access items by index
+	 *
+	 * Complexity is O(n)
+	 * \param index zero-based index of item to get
+	 * \throw std::out_of_range if index is too large (greater or equals to list size)
+	 * \return value of item
+	 */
+	int operator[](std::size_t index) {
+		TRACE_SCOPE("DoublyLinkedList::operator[]");
+		ListNode<T>* current = first;
+		std::size_t cur_index = 0;
+		while(current) {
+			if (cur_index == index) {
+				return current->value;
+			}
+			current = current->next;
+			cur_index++;
+		}
+		throw std::out_of_range{"index="+std::to_string(index)+" larger than list size="+std::to_string(_size)};
+	}
+
+	std::size_t size() const {
+		return _size;
+	}
+
+	std::size_t size_naive() const {
+		TRACE_SCOPE("DoublyLinkedList::size_naive");
+		std::size_t result = 0;
+		ListNode<T>* current = first;
+		while(current) {
+			result++;
+			current = current->next;
+		}
+		return result;
+	}
+
+	/**
+	 * \brief Copy values to contiguous memory, in list order
+	 *
+	 * One walk over the nodes: while a value is copied, the next node is already being loaded (prefetched).
+	 * The prefetch can't go further ahead: the address of a node is only known once its predecessor has
+	 * arrived, so a pointer running k nodes ahead waits for the same chain of loads (no faster on 4e6
+	 * shuffled nodes). What one node ahead overlaps is the copy of the value, e.g. of a long string.
+	 * Complexity is O(n), unlike a loop over operator[] which is O(n^2).
+	 * \param destination array of at least count elements
+	 * \return number of copied values: min(size(), count)
+	 */
+	std::size_t copy_to(T* destination, std::size_t count) const {
+		TRACE_SCOPE("DoublyLinkedList::copy_to");
+		std::size_t copied = 0;
+		for (ListNode<T>* current = first; current && copied < count; current = current->next) {
+#if defined(__GNUC__)
+			__builtin_prefetch(current->next);
+#endif
+			destination[copied++] = current->value;
+		}
+		return copied;
+	}
+
+#if __cplusplus >= 202002L
+	std::size_t copy_to(std::span<T> destination) const {
+		return copy_to(destination.data(), destination.size());
+	}
+#endif
+
+	/**
+	 * \brief Values as a vector, allocated once with the size of the list
+	 */
+	std::vector<T> to_vector() const {
+		TRACE_SCOPE("DoublyLinkedList::to_vector");
+		std::vector<T> result;
+		result.reserve(_size);
+		for (ListNode<T>* current = first; current; current = current->next) {
+#if defined(__GNUC__)
+			__builtin_prefetch(current->next); // one node ahead, see copy_to()
+#endif
+			result.push_back(current->value);
+		}
+		return result;
+	}
+
+	/**
+	 * \brief Bidirectional iterator over values, from the first to the last
+	 *
+	 * end() holds no node, decrementing it moves to the last node. Iterators stay valid until their node is removed.
+	 * \tparam Const iterate over const values
+	 */
+	template<bool Const>
+	class Iterator {
+	private:
+		const DoublyLinkedList<T>* list;
+		ListNode<T>* node;
+		friend class DoublyLinkedList<T>;
+		friend class Iterator<!Const>;
+
+		Iterator(const DoublyLinkedList<T>* list, ListNode<T>* node): list{list}, node{node} {}
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = typename std::conditional<Const, const T*, T*>::type;
+		using reference = typename std::conditional<Const, const T&, T&>::type;
+
+		Iterator(): list{nullptr}, node{nullptr} {}
+
+		/**
+		 * \brief iterator converts to const_iterator
+		 */
+		operator Iterator<true>() const {
+			return Iterator<true>{list, node};
+		}
+
+		reference operator*() const {
+			return node->value;
+		}
+
+		pointer operator->() const {
+			return &node->value;
+		}
+
+		Iterator& operator++() {
+			node = node->next;
+			return *this;
+		}
+
+		Iterator operator++(int) {
+			Iterator result = *this;
+			node = node->next;
+			return result;
+		}
+
+		Iterator& operator--() {
+			node = node ? node->prev : list->last;
+			return *this;
+		}
+
+		Iterator operator--(int) {
+			Iterator result = *this;
+			--*this;
+			return result;
+		}
+
+		friend bool operator==(const Iterator& a, const Iterator& b) {
+			return a.node == b.node;
+		}
+
+		friend bool operator!=(const Iterator& a, const Iterator& b) {
+			return a.node != b.node;
+		}
+	};
+
+	using iterator = Iterator<false>;
+	using const_iterator = Iterator<true>;
+
+	iterator begin() {
+		return iterator{this, first};
+	}
+
+	iterator end() {
+		return iterator{this, nullptr};
+	}
+
+	const_iterator begin() const {
+		return const_iterator{this, first};
+	}
+
+	const_iterator end() const {
+		return const_iterator{this, nullptr};
+	}
+
+	const_iterator cbegin() const {
+		return begin();
+	}
+
+	const_iterator cend() const {
+		return end();
+	}
+
+	std::reverse_iterator<iterator> rbegin() {
+		return std::reverse_iterator<iterator>{end()};
+	}
+
+	std::reverse_iterator<iterator> rend() {
+		return std::reverse_iterator<iterator>{begin()};
+	}
+
+	friend std::ostream& operator<<(std::ostream& out, const DoublyLinkedList<T>& list) {
+		ListNode<T>* current = list.first; //can also use auto current; or auto* current;
+		out<<"[ ";
+		while(current) {
+			out << current->value << " ";
+			current = current->next;
+		}
+		out<<"]";
+		return out;
+	}
+
+	friend void test_doubly_linked_list::test_create_append_clear();
+};
+
+#endif /* CODE_EXAMPLES_LIST_LIST_H_ */
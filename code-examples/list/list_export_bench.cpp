@@ -0,0 +1,85 @@
+/*
+ * list_export_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "list.h"
+#include "list_parallel.h"
+#include "../perf/alloc_counter.h"
+#include "../commands.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace bench_list_export {
+
+template<typename Function>
+void measure(const char* name, std::size_t size, int repeats, Function function) {
+	long long checksum = 0;
+	auto before = alloc_counter::total();
+	auto begin = std::chrono::steady_clock::now();
+	for (int i = 0; i < repeats; i++) {
+		checksum += function();
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - begin;
+	auto used = alloc_counter::total() - before;
+	std::cout<<name<<"\t"<<size<<"\t"<<elapsed.count() / (double(size) * repeats)<<"\t"<<double(used.allocations) / repeats<<"\t"<<checksum<<std::endl;
+}
+
+void fill(DoublyLinkedList<int>& list, std::size_t size) {
+	for (std::size_t i = 0; i < size; i++) {
+		list.append(static_cast<int>(i));
+	}
+}
+
+// usage: bench_list_export [list size] [list size for operator[]] [repeats] [threads]
+int main(int argc, char** argv) {
+	std::size_t size = argc > 1 ? std::atol(argv[1]) : 4000000;
+	std::size_t index_size = argc > 2 ? std::atol(argv[2]) : 20000;
+	int repeats = argc > 3 ? std::atoi(argv[3]) : 5;
+	std::size_t threads = argc > 4 ? std::atol(argv[4]) : 0;
+
+	DoublyLinkedList<int> small_list;
+	fill(small_list, index_size);
+	DoublyLinkedList<int> list;
+	fill(list, size);
+	ThreadPool pool{threads};
+
+	std::cout<<"method\tsize\tns/element\tallocations/copy\tchecksum"<<std::endl;
+	measure("operator[] + push_back", index_size, repeats, [&]() {
+		std::vector<int> result;
+		for (std::size_t i = 0; i < small_list.size(); i++) {
+			result.push_back(small_list[i]);
+		}
+		return result.back();
+	});
+	measure("iterator + push_back", size, repeats, [&]() {
+		std::vector<int> result;
+		for (int value: list) {
+			result.push_back(value);
+		}
+		return result.back();
+	});
+	measure("to_vector()", size, repeats, [&]() {
+		return list.to_vector().back();
+	});
+	std::vector<int> destination(size);
+	measure("copy_to() existing array", size, repeats, [&]() {
+		list.copy_to(destination.data(), destination.size());
+		return destination.back();
+	});
+	measure("parallel to_vector()", size, repeats, [&]() {
+		return list_parallel::to_vector(pool, list).back();
+	});
+	std::cout<<"(parallel with "<<pool.thread_count()<<" threads)"<<std::endl;
+	return 0;
+}
+
+static commands::Registrar registrar{"bench_list_export", commands::Kind::benchmark, main,
+		"list to array export, indexing by operator[] vs array", {"200000", "20000", "2", "2"}};
+
+}
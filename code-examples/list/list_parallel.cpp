@@ -0,0 +1,48 @@
+/*
+ * list_parallel.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "list_parallel.h"
+
+#include "../doctest.h"
+
+#include <string>
+#include <vector>
+
+TEST_CASE("[list parallel] - copy in segments") {
+	ThreadPool pool{4};
+	DoublyLinkedList<long long> list;
+	CHECK(list_parallel::to_vector(pool, list).empty());
+	CHECK(list_parallel::to_vector(pool, list, 4).empty());
+
+	const int size = 10007; // not divisible by the segment counts
+	for (int i = 0; i < size; i++) {
+		list.append(i * 3LL);
+	}
+	std::vector<long long> expected = list.to_vector();
+
+	for (std::size_t segments: {0, 1, 2, 3, 7, 16, 100}) {
+		CAPTURE(segments);
+		CHECK(list_parallel::to_vector(pool, list, segments) == expected);
+	}
+
+	auto boundaries = list_parallel::segment_boundaries(pool, list, 5, 2002);
+	REQUIRE(boundaries.size() == 5);
+	for (std::size_t segment = 0; segment < 5; segment++) {
+		CHECK(*boundaries[segment] == segment * 2002 * 3LL);
+	}
+}
+
+TEST_CASE("[list parallel] - strings") {
+	ThreadPool pool{3};
+	DoublyLinkedList<std::string> list;
+	for (int i = 0; i < 20000; i++) {
+		list.append("value number " + std::to_string(i));
+	}
+	std::vector<std::string> copied(list.size());
+	list_parallel::copy_to(pool, list, copied.data());
+	CHECK(copied == list.to_vector());
+}
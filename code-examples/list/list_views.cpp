@@ -0,0 +1,172 @@
+/*
+ * list_views.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "list_views.h"
+#include "list.h"
+#include "../perf/alloc_counter.h"
+
+#include "../doctest.h"
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+namespace test_list_views {
+
+template<typename Range>
+std::string to_string(const Range& range) {
+	std::stringstream s_out;
+	s_out<<"[ ";
+	for (auto&& value: range) {
+		s_out << value << " ";
+	}
+	s_out<<"]";
+	return s_out.str();
+}
+
+}
+
+using namespace test_list_views;
+
+TEST_CASE("[list] - iterators") {
+	DoublyLinkedList<int> list;
+	CHECK(list.begin() == list.end());
+	for (int i = 1; i <= 5; i++) {
+		list.append(i);
+	}
+
+	int sum = 0;
+	for (int value: list) {
+		sum += value;
+	}
+	CHECK(sum == 15);
+
+	for (int& value: list) {
+		value *= 10;
+	}
+	std::stringstream s_out;
+	s_out<<list;
+	CHECK(s_out.str() == "[ 10 20 30 40 50 ]");
+
+	CHECK(std::find(list.begin(), list.end(), 30) != list.end());
+	CHECK(std::find(list.begin(), list.end(), 31) == list.end());
+	CHECK(std::distance(list.begin(), list.end()) == 5);
+
+	// backwards from end()
+	std::vector<int> reversed(list.rbegin(), list.rend());
+	CHECK(reversed == std::vector<int>{50, 40, 30, 20, 10});
+	auto last = list.end();
+	--last;
+	CHECK(*last == 50);
+
+	const DoublyLinkedList<int>& const_list = list;
+	DoublyLinkedList<int>::const_iterator it = list.begin();
+	CHECK(it == const_list.begin());
+	CHECK(*it++ == 10);
+	CHECK(*it == 20);
+}
+
+TEST_CASE("[list views] - adaptors") {
+	DoublyLinkedList<int> list;
+	for (int i = 1; i <= 10; i++) {
+		list.append(i);
+	}
+	auto square = [](int x) { return x * x; };
+	auto even = [](int x) { return x % 2 == 0; };
+
+	CHECK(to_string(list_views::map(list, square)) == "[ 1 4 9 16 25 36 49 64 81 100 ]");
+	CHECK(to_string(list | list_views::filter(even)) == "[ 2 4 6 8 10 ]");
+	CHECK(to_string(list | list_views::take(3)) == "[ 1 2 3 ]");
+	CHECK(to_string(list | list_views::take(30)) == to_string(list));
+	CHECK(to_string(list | list_views::take(0)) == "[ ]");
+	CHECK(to_string(list | list_views::drop(7)) == "[ 8 9 10 ]");
+	CHECK(to_string(list | list_views::drop(30)) == "[ ]");
+
+	SUBCASE("pipelines") {
+		auto pipeline = list | list_views::filter(even) | list_views::map(square) | list_views::drop(1) | list_views::take(2);
+		CHECK(to_string(pipeline) == "[ 16 36 ]");
+		CHECK(to_string(pipeline) == "[ 16 36 ]"); // can be iterated again
+		CHECK(to_string(list_views::take(list_views::drop(list_views::map(list_views::filter(list, even), square), 1), 2)) == "[ 16 36 ]");
+		CHECK(std::count_if(pipeline.begin(), pipeline.end(), [](int x) { return x > 20; }) == 1);
+	}
+
+	SUBCASE("views see changes of the list") {
+		auto squares = list | list_views::map(square);
+		list.append(11);
+		CHECK(to_string(squares | list_views::drop(10)) == "[ 121 ]");
+	}
+
+	SUBCASE("zip") {
+		std::vector<std::string> names{"one", "two", "three"};
+		std::vector<std::string> pairs;
+		for (auto pair: list_views::zip(list, names)) {
+			pairs.push_back(std::to_string(pair.first) + "=" + pair.second);
+		}
+		CHECK(pairs == std::vector<std::string>{"1=one", "2=two", "3=three"});
+
+		// elements are references
+		for (auto pair: list | list_views::drop(8) | list_views::zip(names)) {
+			pair.first = -pair.first;
+		}
+		CHECK(to_string(list | list_views::drop(8)) == "[ -9 -10 ]");
+	}
+}
+
+TEST_CASE("[list views] - lazy and without allocations") {
+	DoublyLinkedList<int> list;
+	for (int i = 0; i < 1000; i++) {
+		list.append(i);
+	}
+	int mapped = 0;
+	int tested = 0;
+	auto pipeline = list
+		| list_views::map([&mapped](int x) { mapped++; return x * 3; })
+		| list_views::filter([&tested](int x) { tested++; return x % 2 == 0; })
+		| list_views::take(5);
+
+	auto before = alloc_counter::total();
+	long long sum = 0;
+	for (int value: pipeline) {
+		sum += value;
+	}
+	auto used = alloc_counter::total() - before;
+	CHECK(used.allocations == 0);
+	CHECK(sum == 0 + 6 + 12 + 18 + 24);
+	CHECK(tested == 9); // 0..8, nothing after the fifth even value
+	CHECK(mapped == 9 + 5); // map is called by filter, then again when the value is read
+
+	DoublyLinkedList<int> result;
+	list_views::append_to(result, pipeline);
+	CHECK(result.size() == 5);
+}
+
+#if __cplusplus >= 202002L
+TEST_CASE("[list views] - C++20 ranges") {
+	static_assert(std::ranges::bidirectional_range<DoublyLinkedList<int>>);
+	static_assert(std::ranges::bidirectional_range<const DoublyLinkedList<int>>);
+
+	DoublyLinkedList<int> list;
+	for (int i = 1; i <= 6; i++) {
+		list.append(i);
+	}
+	auto pipeline = list | list_views::map([](int x) { return x + 1; }) | list_views::filter([](int x) { return x % 3 == 0; });
+	static_assert(std::ranges::forward_range<decltype(pipeline)>);
+	CHECK(std::ranges::count(pipeline, 6) == 1);
+	CHECK(std::ranges::distance(pipeline) == 2);
+
+	auto standard = list | std::views::reverse | std::views::transform([](int x) { return x * 2; }) | std::views::take(2);
+	std::vector<int> values;
+	std::ranges::copy(standard, std::back_inserter(values));
+	CHECK(values == std::vector<int>{12, 10});
+}
+#endif
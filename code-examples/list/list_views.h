@@ -0,0 +1,470 @@
+/*
+ * list_views.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_LIST_LIST_VIEWS_H_
+#define CODE_EXAMPLES_LIST_LIST_VIEWS_H_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \brief Lazy views over DoublyLinkedList (and any other range with begin() and end())
+ *
+ * A view computes its elements while it is iterated: no nodes and no copies are created, a pipeline of views
+ * runs in one pass. Views can be chained with operator| or nested as function calls:
+ *
+ *     list | list_views::map(f) | list_views::filter(p) | list_views::take(10)
+ *     list_views::take(list_views::filter(list_views::map(list, f), p), 10)
+ *
+ * A container is referenced, it must outlive its views; views are copied into views built on them.
+ * Functions and predicates are called through a const reference, on every dereference (map) or every step (filter).
+ * Iterators are forward iterators, so views work with range-for, standard algorithms and C++20 std::ranges algorithms.
+ */
+namespace list_views {
+
+/**
+ * \brief Base of all views, containers are not derived from it
+ */
+struct ViewBase {};
+
+template<typename Range>
+using iterator_of = decltype(std::declval<const Range&>().begin());
+
+template<typename Range>
+using reference_of = decltype(*std::declval<iterator_of<Range>&>());
+
+template<typename Range>
+using value_of = typename std::remove_cv<typename std::remove_reference<reference_of<Range>>::type>::type;
+
+/**
+ * \brief View of a whole container
+ */
+template<typename Container>
+class RefView: public ViewBase {
+private:
+	Container* container;
+public:
+	RefView(): container{nullptr} {}
+	explicit RefView(Container& container): container{&container} {}
+
+	auto begin() const {
+		return container->begin();
+	}
+
+	auto end() const {
+		return container->end();
+	}
+};
+
+/**
+ * \brief Views are copied, containers are referenced
+ */
+template<typename Range>
+auto as_view(Range&& range) {
+	using Plain = typename std::decay<Range>::type;
+	if constexpr (std::is_base_of<ViewBase, Plain>::value) {
+		return Plain{std::forward<Range>(range)};
+	} else {
+		static_assert(std::is_lvalue_reference<Range>::value, "a view can't own a container, create it from a variable");
+		return RefView<typename std::remove_reference<Range>::type>{range};
+	}
+}
+
+template<typename Range>
+using view_of = decltype(as_view(std::declval<Range>()));
+
+/**
+ * \brief function(element) for every element
+ */
+template<typename Base, typename Function>
+class MapView: public ViewBase {
+private:
+	Base base;
+	Function function;
+public:
+	class Iterator {
+	private:
+		const MapView* view;
+		iterator_of<Base> current;
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using reference = decltype(std::declval<const Function&>()(std::declval<reference_of<Base>>()));
+		using value_type = typename std::remove_cv<typename std::remove_reference<reference>::type>::type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+
+		Iterator(): view{nullptr}, current{} {}
+		Iterator(const MapView* view, iterator_of<Base> current): view{view}, current{current} {}
+
+		reference operator*() const {
+			return view->function(*current);
+		}
+
+		Iterator& operator++() {
+			++current;
+			return *this;
+		}
+
+		Iterator operator++(int) {
+			Iterator result = *this;
+			++current;
+			return result;
+		}
+
+		friend bool operator==(const Iterator& a, const Iterator& b) {
+			return a.current == b.current;
+		}
+
+		friend bool operator!=(const Iterator& a, const Iterator& b) {
+			return !(a == b);
+		}
+	};
+
+	MapView(Base base, Function function): base{std::move(base)}, function{std::move(function)} {}
+
+	Iterator begin() const {
+		return Iterator{this, base.begin()};
+	}
+
+	Iterator end() const {
+		return Iterator{this, base.end()};
+	}
+};
+
+/**
+ * \brief Elements for which predicate(element) is true
+ *
+ * begin() searches for the first such element, so it is O(n) for every call.
+ */
+template<typename Base, typename Predicate>
+class FilterView: public ViewBase {
+private:
+	Base base;
+	Predicate predicate;
+public:
+	class Iterator {
+	private:
+		const FilterView* view;
+		iterator_of<Base> current;
+		iterator_of<Base> last;
+
+		void skip() {
+			while (current != last && !view->predicate(*current)) {
+				++current;
+			}
+		}
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using reference = reference_of<Base>;
+		using value_type = value_of<Base>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+
+		Iterator(): view{nullptr}, current{}, last{} {}
+		Iterator(const FilterView* view, iterator_of<Base> current, iterator_of<Base> last): view{view}, current{current}, last{last} {
+			skip();
+		}
+
+		reference operator*() const {
+			return *current;
+		}
+
+		Iterator& operator++() {
+			++current;
+			skip();
+			return *this;
+		}
+
+		Iterator operator++(int) {
+			Iterator result = *this;
+			++*this;
+			return result;
+		}
+
+		friend bool operator==(const Iterator& a, const Iterator& b) {
+			return a.current == b.current;
+		}
+
+		friend bool operator!=(const Iterator& a, const Iterator& b) {
+			return !(a == b);
+		}
+	};
+
+	FilterView(Base base, Predicate predicate): base{std::move(base)}, predicate{std::move(predicate)} {}
+
+	Iterator begin() const {
+		return Iterator{this, base.begin(), base.end()};
+	}
+
+	Iterator end() const {
+		return Iterator{this, base.end(), base.end()};
+	}
+};
+
+/**
+ * \brief The first count elements (all of them if there are fewer)
+ *
+ * Stops after count elements: the rest of the base view is never computed.
+ */
+template<typename Base>
+class TakeView: public ViewBase {
+private:
+	Base base;
+	std::size_t count;
+public:
+	class Iterator {
+	private:
+		iterator_of<Base> current;
+		iterator_of<Base> last;
+		std::size_t remaining;
+
+		bool done() const {
+			return remaining == 0 || current == last;
+		}
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using reference = reference_of<Base>;
+		using value_type = value_of<Base>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+
+		Iterator(): current{}, last{}, remaining{0} {}
+		Iterator(iterator_of<Base> current, iterator_of<Base> last, std::size_t remaining): current{current}, last{last}, remaining{remaining} {}
+
+		reference operator*() const {
+			return *current;
+		}
+
+		Iterator& operator++() {
+			--remaining;
+			if (remaining > 0) { // don't step the base past the last taken element, it can be expensive (filter)
+				++current;
+			}
+			return *this;
+		}
+
+		Iterator operator++(int) {
+			Iterator result = *this;
+			++*this;
+			return result;
+		}
+
+		friend bool operator==(const Iterator& a, const Iterator& b) {
+			if (a.done() || b.done()) {
+				return a.done() == b.done();
+			}
+			return a.current == b.current;
+		}
+
+		friend bool operator!=(const Iterator& a, const Iterator& b) {
+			return !(a == b);
+		}
+	};
+
+	TakeView(Base base, std::size_t count): base{std::move(base)}, count{count} {}
+
+	Iterator begin() const {
+		return Iterator{base.begin(), base.end(), count};
+	}
+
+	Iterator end() const {
+		return Iterator{base.end(), base.end(), 0};
+	}
+};
+
+/**
+ * \brief All elements except the first count
+ *
+ * begin() steps over count elements, so it is O(count) for every call.
+ */
+template<typename Base>
+class DropView: public ViewBase {
+private:
+	Base base;
+	std::size_t count;
+public:
+	DropView(Base base, std::size_t count): base{std::move(base)}, count{count} {}
+
+	iterator_of<Base> begin() const {
+		auto current = base.begin();
+		auto last = base.end();
+		for (std::size_t i = 0; i < count && current != last; i++) {
+			++current;
+		}
+		return current;
+	}
+
+	iterator_of<Base> end() const {
+		return base.end();
+	}
+};
+
+/**
+ * \brief Pairs of elements at the same positions, as long as the shorter view
+ *
+ * Elements are std::pair of references to the elements of the two views.
+ */
+template<typename First, typename Second>
+class ZipView: public ViewBase {
+private:
+	First first;
+	Second second;
+public:
+	class Iterator {
+	private:
+		iterator_of<First> current_first;
+		iterator_of<First> last_first;
+		iterator_of<Second> current_second;
+		iterator_of<Second> last_second;
+
+		bool done() const {
+			return current_first == last_first || current_second == last_second;
+		}
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using reference = std::pair<reference_of<First>, reference_of<Second>>;
+		using value_type = std::pair<value_of<First>, value_of<Second>>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+
+		Iterator() = default;
+		Iterator(iterator_of<First> current_first, iterator_of<First> last_first, iterator_of<Second> current_second, iterator_of<Second> last_second):
+			current_first{current_first}, last_first{last_first}, current_second{current_second}, last_second{last_second} {}
+
+		reference operator*() const {
+			return reference{*current_first, *current_second};
+		}
+
+		Iterator& operator++() {
+			++current_first;
+			++current_second;
+			return *this;
+		}
+
+		Iterator operator++(int) {
+			Iterator result = *this;
+			++*this;
+			return result;
+		}
+
+		friend bool operator==(const Iterator& a, const Iterator& b) {
+			if (a.done() || b.done()) {
+				return a.done() == b.done();
+			}
+			return a.current_first == b.current_first && a.current_second == b.current_second;
+		}
+
+		friend bool operator!=(const Iterator& a, const Iterator& b) {
+			return !(a == b);
+		}
+	};
+
+	ZipView(First first, Second second): first{std::move(first)}, second{std::move(second)} {}
+
+	Iterator begin() const {
+		return Iterator{first.begin(), first.end(), second.begin(), second.end()};
+	}
+
+	Iterator end() const {
+		return Iterator{first.end(), first.end(), second.end(), second.end()};
+	}
+};
+
+/**
+ * \brief Right side of operator|: remembers the arguments of a view except the range
+ */
+template<typename Make>
+struct Adaptor {
+	Make make;
+};
+
+template<typename Make>
+Adaptor<Make> adaptor(Make make) {
+	return Adaptor<Make>{std::move(make)};
+}
+
+template<typename Range, typename Make>
+auto operator|(Range&& range, const Adaptor<Make>& adaptor) {
+	return adaptor.make(as_view(std::forward<Range>(range)));
+}
+
+template<typename Range, typename Function>
+MapView<view_of<Range>, Function> map(Range&& range, Function function) {
+	return {as_view(std::forward<Range>(range)), std::move(function)};
+}
+
+template<typename Function>
+auto map(Function function) {
+	return adaptor([function](auto view) {
+		return map(std::move(view), function);
+	});
+}
+
+template<typename Range, typename Predicate>
+FilterView<view_of<Range>, Predicate> filter(Range&& range, Predicate predicate) {
+	return {as_view(std::forward<Range>(range)), std::move(predicate)};
+}
+
+template<typename Predicate>
+auto filter(Predicate predicate) {
+	return adaptor([predicate](auto view) {
+		return filter(std::move(view), predicate);
+	});
+}
+
+template<typename Range>
+TakeView<view_of<Range>> take(Range&& range, std::size_t count) {
+	return {as_view(std::forward<Range>(range)), count};
+}
+
+inline auto take(std::size_t count) {
+	return adaptor([count](auto view) {
+		return take(std::move(view), count);
+	});
+}
+
+template<typename Range>
+DropView<view_of<Range>> drop(Range&& range, std::size_t count) {
+	return {as_view(std::forward<Range>(range)), count};
+}
+
+inline auto drop(std::size_t count) {
+	return adaptor([count](auto view) {
+		return drop(std::move(view), count);
+	});
+}
+
+template<typename First, typename Second>
+ZipView<view_of<First>, view_of<Second>> zip(First&& first, Second&& second) {
+	return {as_view(std::forward<First>(first)), as_view(std::forward<Second>(second))};
+}
+
+/**
+ * \brief range | zip(second)
+ */
+template<typename Second>
+auto zip(Second& second) {
+	return adaptor([&second](auto view) {
+		return zip(std::move(view), second);
+	});
+}
+
+/**
+ * \brief Append all elements of range to container (DoublyLinkedList, IntrusiveList...) - materializes a view
+ */
+template<typename Container, typename Range>
+void append_to(Container& container, Range&& range) {
+	for (auto&& value: range) {
+		container.append(value);
+	}
+}
+
+}
+
+#endif /* CODE_EXAMPLES_LIST_LIST_VIEWS_H_ */
@@ -0,0 +1,102 @@
+/*
+ * list_views_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "list.h"
+#include "list_views.h"
+#include "../perf/alloc_counter.h"
+#include "../commands.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace bench_list_views {
+
+// the three stages of the pipeline
+long long scale(int x) {
+	return 3LL * x + 1;
+}
+
+bool keep(long long x) {
+	return x % 4 != 0;
+}
+
+long long shrink(long long x) {
+	return x / 2;
+}
+
+/**
+ * \brief Every stage builds a new list
+ */
+long long materialized(DoublyLinkedList<int>& list) {
+	DoublyLinkedList<long long> scaled;
+	for (int value: list) {
+		scaled.append(scale(value));
+	}
+	DoublyLinkedList<long long> kept;
+	for (long long value: scaled) {
+		if (keep(value)) {
+			kept.append(value);
+		}
+	}
+	DoublyLinkedList<long long> shrunk;
+	for (long long value: kept) {
+		shrunk.append(shrink(value));
+	}
+	long long sum = 0;
+	for (long long value: shrunk) {
+		sum += value;
+	}
+	return sum;
+}
+
+/**
+ * \brief One pass, no intermediate lists
+ */
+long long lazy(DoublyLinkedList<int>& list) {
+	long long sum = 0;
+	for (long long value: list | list_views::map(scale) | list_views::filter(keep) | list_views::map(shrink)) {
+		sum += value;
+	}
+	return sum;
+}
+
+template<typename Pipeline>
+void measure(const char* name, DoublyLinkedList<int>& list, int repeats, Pipeline pipeline) {
+	long long sum = 0;
+	auto before = alloc_counter::total();
+	auto begin = std::chrono::steady_clock::now();
+	for (int i = 0; i < repeats; i++) {
+		sum += pipeline(list);
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - begin;
+	auto used = alloc_counter::total() - before;
+	double elements = double(list.size()) * repeats;
+	std::cout<<name<<"\t"<<elapsed.count() / elements<<"\t"<<used.allocations / elements<<"\t"<<sum<<std::endl;
+}
+
+// usage: bench_list_views [list size] [repeats]
+int main(int argc, char** argv) {
+	int size = argc > 1 ? std::atoi(argv[1]) : 1000000;
+	int repeats = argc > 2 ? std::atoi(argv[2]) : 10;
+
+	DoublyLinkedList<int> list;
+	for (int i = 0; i < size; i++) {
+		list.append(i);
+	}
+
+	std::cout<<"map | filter | map over "<<size<<" elements"<<std::endl;
+	std::cout<<"pipeline\tns/element\tallocations/element\tchecksum"<<std::endl;
+	measure("materialized", list, repeats, materialized);
+	measure("lazy views", list, repeats, lazy);
+	return 0;
+}
+
+static commands::Registrar registrar{"bench_list_views", commands::Kind::benchmark, main,
+		"materialized vs lazy list pipelines", {"100000", "3"}};
+
+}
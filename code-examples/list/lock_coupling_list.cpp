@@ -0,0 +1,270 @@
+/*
+ * lock_coupling_list.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "lock_coupling_list.h"
+
+#include "../doctest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace test_lock_coupling_list {
+
+enum class Kind { insert, erase, contains };
+
+/**
+ * \brief One completed operation of a concurrent history
+ *
+ * invoked and responded are tickets from a shared counter, they order events in real time.
+ */
+struct Operation {
+	Kind kind;
+	int key;
+	bool result;
+	long long invoked;
+	long long responded;
+};
+
+/**
+ * \brief Result of the operation on a sequential set with one key, changes present
+ */
+bool apply(Kind kind, bool& present) {
+	switch (kind) {
+	case Kind::insert: {
+		bool result = !present;
+		present = true;
+		return result;
+	}
+	case Kind::erase: {
+		bool result = present;
+		present = false;
+		return result;
+	}
+	default:
+		return present;
+	}
+}
+
+/**
+ * \brief Search for a linearization (Wing & Gong): an order of operations which respects real time and gives the same results
+ *
+ * An operation can go next only if no other remaining operation had responded before it was invoked.
+ * Failed states (set of done operations, value of the set) are remembered, so every state is explored once.
+ */
+bool linearize(const std::vector<Operation>& history, std::uint64_t done, bool present, std::set<std::pair<std::uint64_t, bool>>& failed) {
+	if (done == (history.size() == 64 ? ~0ULL : (1ULL << history.size()) - 1)) {
+		return true;
+	}
+	if (failed.count({done, present})) {
+		return false;
+	}
+	for (std::size_t i = 0; i < history.size(); i++) {
+		if (done & (1ULL << i)) {
+			continue;
+		}
+		bool minimal = true;
+		for (std::size_t j = 0; j < history.size() && minimal; j++) {
+			if (j != i && !(done & (1ULL << j)) && history[j].responded < history[i].invoked) {
+				minimal = false;
+			}
+		}
+		if (!minimal) {
+			continue;
+		}
+		bool state = present;
+		if (apply(history[i].kind, state) == history[i].result &&
+				linearize(history, done | (1ULL << i), state, failed)) {
+			return true;
+		}
+	}
+	failed.insert({done, present});
+	return false;
+}
+
+/**
+ * \brief Linearizability of a set history can be checked for every key separately (it is a local property)
+ */
+bool linearizable(const std::vector<Operation>& history, int key, bool initially_present) {
+	std::vector<Operation> key_history;
+	for (const Operation& operation: history) {
+		if (operation.key == key) {
+			key_history.push_back(operation);
+		}
+	}
+	REQUIRE(key_history.size() <= 64);
+	std::set<std::pair<std::uint64_t, bool>> failed;
+	return linearize(key_history, 0, initially_present, failed);
+}
+
+}
+
+using namespace test_lock_coupling_list;
+
+TEST_CASE("[lock coupling list] - single thread") {
+	LockCouplingList<int> list;
+	CHECK(list.size() == 0);
+	CHECK_FALSE(list.contains(1));
+
+	CHECK(list.insert(3));
+	CHECK(list.insert(1));
+	CHECK(list.insert(2));
+	CHECK_FALSE(list.insert(2));
+	CHECK(list.size() == 3);
+	{
+		std::stringstream s_out;
+		s_out<<list;
+		CHECK(s_out.str() == "[ 1 2 3 ]");
+	}
+
+	CHECK(list.contains(2));
+	CHECK(list.erase(2));
+	CHECK_FALSE(list.erase(2));
+	CHECK_FALSE(list.contains(2));
+	CHECK(list.erase(3)); // last
+	CHECK(list.erase(1)); // first
+	CHECK(list.size() == 0);
+	CHECK(list.insert(4));
+	{
+		std::stringstream s_out;
+		s_out<<list;
+		CHECK(s_out.str() == "[ 4 ]");
+	}
+}
+
+TEST_CASE("[lock coupling list] - linearizability stress") {
+	const int rounds = 200;
+	const int threads = 4;
+	const int operations_per_thread = 8;
+	const int keys = 3;
+	std::mt19937 random{2020};
+
+	int failures = 0;
+	for (int round = 0; round < rounds; round++) {
+		LockCouplingList<int> list;
+		std::vector<bool> initially_present(keys);
+		for (int key = 0; key < keys; key++) {
+			initially_present[key] = random() % 2;
+			if (initially_present[key]) {
+				list.insert(key);
+			}
+		}
+
+		std::atomic<long long> clock{0};
+		std::vector<std::vector<Operation>> histories(threads);
+		std::vector<unsigned> seeds(threads);
+		for (auto& seed: seeds) {
+			seed = random();
+		}
+		std::atomic<bool> start{false};
+		std::vector<std::thread> workers;
+		for (int t = 0; t < threads; t++) {
+			workers.emplace_back([&, t]() {
+				std::mt19937 local_random{seeds[t]};
+				while (!start) {
+					std::this_thread::yield();
+				}
+				for (int i = 0; i < operations_per_thread; i++) {
+					Operation operation;
+					operation.kind = static_cast<Kind>(local_random() % 3);
+					operation.key = local_random() % keys;
+					operation.invoked = clock++;
+					switch (operation.kind) {
+					case Kind::insert: operation.result = list.insert(operation.key); break;
+					case Kind::erase: operation.result = list.erase(operation.key); break;
+					default: operation.result = list.contains(operation.key);
+					}
+					operation.responded = clock++;
+					histories[t].push_back(operation);
+				}
+			});
+		}
+		start = true;
+		for (auto& worker: workers) {
+			worker.join();
+		}
+
+		std::vector<Operation> history;
+		for (auto& thread_history: histories) {
+			history.insert(history.end(), thread_history.begin(), thread_history.end());
+		}
+		for (int key = 0; key < keys; key++) {
+			if (!linearizable(history, key, initially_present[key])) {
+				failures++;
+			}
+		}
+	}
+	CHECK(failures == 0);
+}
+
+TEST_CASE("[lock coupling list] - the checker finds non-linearizable histories") {
+	// insert succeeds twice without erase in between
+	std::vector<Operation> history{
+		{Kind::insert, 0, true, 0, 1},
+		{Kind::insert, 0, true, 2, 3},
+	};
+	CHECK_FALSE(linearizable(history, 0, false));
+
+	// overlapping operations can be ordered either way
+	std::vector<Operation> overlapping{
+		{Kind::insert, 0, true, 0, 3},
+		{Kind::contains, 0, false, 1, 2},
+	};
+	CHECK(linearizable(overlapping, 0, false));
+
+	// but not against real time: contains started after insert had finished
+	std::vector<Operation> late{
+		{Kind::insert, 0, true, 0, 1},
+		{Kind::contains, 0, false, 2, 3},
+	};
+	CHECK_FALSE(linearizable(late, 0, false));
+}
+
+TEST_CASE("[lock coupling list] - concurrent edits of disjoint and shared ranges") {
+	LockCouplingList<int> list;
+	const int threads = 4;
+	const int per_thread = 2000;
+
+	std::vector<std::thread> workers;
+	for (int t = 0; t < threads; t++) {
+		workers.emplace_back([&list, t]() {
+			// own keys: t, t + threads, ... - inserted, every second erased
+			for (int i = 0; i < per_thread; i++) {
+				list.insert(t + i*threads);
+			}
+			for (int i = 0; i < per_thread; i += 2) {
+				list.erase(t + i*threads);
+			}
+			// shared keys: every thread inserts and erases each of them, whoever's erase comes last they end up
+			// erased - checked below by the size and by no negative values left
+			for (int i = 0; i < 100; i++) {
+				list.insert(-1 - i);
+				list.erase(-1 - i);
+			}
+		});
+	}
+	for (auto& worker: workers) {
+		worker.join();
+	}
+
+	CHECK(list.size() == threads * per_thread / 2);
+	int previous = -1;
+	bool ordered = true;
+	std::size_t count = 0;
+	list.for_each([&](int value) {
+		ordered = ordered && value > previous;
+		previous = value;
+		count++;
+	});
+	CHECK(ordered);
+	CHECK(count == list.size());
+}
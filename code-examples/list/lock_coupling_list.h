@@ -0,0 +1,192 @@
+/*
+ * lock_coupling_list.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_LIST_LOCK_COUPLING_LIST_H_
+#define CODE_EXAMPLES_LIST_LOCK_COUPLING_LIST_H_
+
+#include "../concurrency/sharded_counter.h"
+#include "../concurrency/spinlock.h"
+
+#include <cstddef>
+#include <ostream>
+
+/**
+ * \brief A node of LockCouplingList: ListNode with its own lock
+ * \see ListNode
+ */
+template<typename T>
+struct LockCouplingNode {
+	T value;						/**< Value stored in this node */
+	LockCouplingNode<T>* prev;		/**< Pointer to the previous node (head sentinel for the first node) */
+	LockCouplingNode<T>* next;		/**< Pointer to the next node (tail sentinel for the last node) */
+	Spinlock lock;					/**< Protects next and prev of this node */
+
+	LockCouplingNode(const T& value, LockCouplingNode<T>* prev=nullptr, LockCouplingNode<T>* next=nullptr): value{value}, prev{prev}, next{next} {}
+};
+
+/**
+ * \brief Sorted doubly linked list for concurrent inserts and erases in the middle
+ *
+ * Keeps unique values in ascending order (by operator<). Every node has a spinlock, threads move along the list
+ * with lock coupling (hand-over-hand): the lock of the next node is taken before the lock of the current one
+ * is released. An insert holds the locks of the two nodes around the new one, an erase holds the locks
+ * of the erased node and its neighbours, so changes in different parts of the list run in parallel.
+ * Locks are always taken from head to tail, so there are no deadlocks.
+ *
+ * A node can be reached only through its locked predecessor, so an erased node is deleted right away.
+ * All operations are linearizable. Complexity is O(n) for insert, erase and contains.
+ * T must be default constructible (for the head and tail sentinels).
+ */
+template<typename T>
+class LockCouplingList {
+private:
+	using Node = LockCouplingNode<T>;
+
+	Node head;
+	Node tail;
+	ShardedCounter<> _size;
+
+	/**
+	 * \brief Walk to the first node not less than value
+	 *
+	 * \return pred and curr, both locked: pred->value < value <= curr->value (curr can be the tail)
+	 */
+	void locate(const T& value, Node*& pred, Node*& curr) {
+		pred = &head;
+		pred->lock.lock();
+		curr = pred->next;
+		curr->lock.lock();
+		while (curr != &tail && curr->value < value) {
+			pred->lock.unlock();
+			pred = curr;
+			curr = curr->next;
+			curr->lock.lock();
+		}
+	}
+
+	bool is_value(Node* node, const T& value) const {
+		return node != &tail && !(value < node->value);
+	}
+public:
+	LockCouplingList(): head{T{}}, tail{T{}} {
+		head.next = &tail;
+		tail.prev = &head;
+	}
+
+	LockCouplingList(const LockCouplingList&) = delete;
+	LockCouplingList& operator=(const LockCouplingList&) = delete;
+
+	/**
+	 * \brief Destroys the list, no other thread may use it any more
+	 */
+	~LockCouplingList() {
+		Node* current = head.next;
+		while (current != &tail) {
+			Node* to_delete = current;
+			current = current->next;
+			delete to_delete;
+		}
+	}
+
+	/**
+	 * \brief Insert value at its sorted position
+	 * \return false if the value is already in the list
+	 */
+	bool insert(const T& value) {
+		Node* new_node = new Node{value}; // allocate before taking locks
+		Node* pred;
+		Node* curr;
+		locate(value, pred, curr);
+		bool inserted = !is_value(curr, value);
+		if (inserted) {
+			new_node->prev = pred;
+			new_node->next = curr;
+			pred->next = new_node;
+			curr->prev = new_node;
+		}
+		curr->lock.unlock();
+		pred->lock.unlock();
+		if (inserted) {
+			_size.add(1);
+		} else {
+			delete new_node;
+		}
+		return inserted;
+	}
+
+	/**
+	 * \brief Erase value
+	 * \return false if there was no such value
+	 */
+	bool erase(const T& value) {
+		Node* pred;
+		Node* curr;
+		locate(value, pred, curr);
+		if (!is_value(curr, value)) {
+			curr->lock.unlock();
+			pred->lock.unlock();
+			return false;
+		}
+		Node* succ = curr->next;
+		succ->lock.lock();
+		pred->next = succ;
+		succ->prev = pred;
+		succ->lock.unlock();
+		curr->lock.unlock();
+		pred->lock.unlock();
+		delete curr; // nobody else can hold or wait for curr - that requires the lock of pred
+		_size.add(-1);
+		return true;
+	}
+
+	bool contains(const T& value) {
+		Node* pred;
+		Node* curr;
+		locate(value, pred, curr);
+		bool result = is_value(curr, value);
+		curr->lock.unlock();
+		pred->lock.unlock();
+		return result;
+	}
+
+	/**
+	 * \brief Call function for each value in ascending order, with lock coupling
+	 *
+	 * function is called while the node is locked, it must not use this list.
+	 */
+	template<typename Function>
+	void for_each(Function function) {
+		Node* current = &head;
+		current->lock.lock();
+		while (current->next != &tail) {
+			Node* next = current->next;
+			next->lock.lock();
+			current->lock.unlock();
+			current = next;
+			function(current->value);
+		}
+		current->lock.unlock();
+	}
+
+	/**
+	 * \brief Number of values, exact when no operations run at the same time
+	 */
+	std::size_t size() const {
+		return static_cast<std::size_t>(_size.load());
+	}
+
+	friend std::ostream& operator<<(std::ostream& out, LockCouplingList<T>& list) {
+		out<<"[ ";
+		list.for_each([&out](const T& value) {
+			out << value << " ";
+		});
+		out<<"]";
+		return out;
+	}
+};
+
+#endif /* CODE_EXAMPLES_LIST_LOCK_COUPLING_LIST_H_ */
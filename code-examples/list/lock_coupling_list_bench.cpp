@@ -0,0 +1,121 @@
+/*
+ * lock_coupling_list_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "lock_coupling_list.h"
+#include "../commands.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace bench_lock_coupling_list {
+
+/**
+ * \brief Baseline: sorted list with one mutex for everything
+ */
+class GlobalMutexList {
+private:
+	std::list<int> values;
+	std::mutex mutex;
+public:
+	bool insert(int value) {
+		std::lock_guard<std::mutex> lock{mutex};
+		auto it = std::lower_bound(values.begin(), values.end(), value);
+		if (it != values.end() && *it == value) {
+			return false;
+		}
+		values.insert(it, value);
+		return true;
+	}
+
+	bool erase(int value) {
+		std::lock_guard<std::mutex> lock{mutex};
+		auto it = std::lower_bound(values.begin(), values.end(), value);
+		if (it == values.end() || *it != value) {
+			return false;
+		}
+		values.erase(it);
+		return true;
+	}
+
+	bool contains(int value) {
+		std::lock_guard<std::mutex> lock{mutex};
+		auto it = std::lower_bound(values.begin(), values.end(), value);
+		return it != values.end() && *it == value;
+	}
+};
+
+/**
+ * \brief Every thread does operations random inserts (20%), erases (20%) and lookups (60%) of keys in [0, keys)
+ * \return operations per second of all threads together
+ */
+template<typename List>
+double measure(int threads, long operations, int keys) {
+	List list;
+	for (int key = 0; key < keys; key += 2) {
+		list.insert(key);
+	}
+	std::atomic<bool> start{false};
+	std::vector<std::thread> workers;
+	for (int t = 0; t < threads; t++) {
+		workers.emplace_back([&, t]() {
+			std::minstd_rand random(t + 1);
+			while (!start.load(std::memory_order_acquire)) {
+				std::this_thread::yield();
+			}
+			for (long i = 0; i < operations; i++) {
+				int key = random() % keys;
+				int kind = random() % 10;
+				if (kind < 2) {
+					list.insert(key);
+				} else if (kind < 4) {
+					list.erase(key);
+				} else {
+					list.contains(key);
+				}
+			}
+		});
+	}
+	auto begin = std::chrono::steady_clock::now();
+	start.store(true, std::memory_order_release);
+	for (auto& worker: workers) {
+		worker.join();
+	}
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	return threads * operations / seconds;
+}
+
+// usage: bench_lock_coupling_list [operations per thread] [keys] [max threads]
+int main(int argc, char** argv) {
+	long operations = argc > 1 ? std::atol(argv[1]) : 100000;
+	int keys = argc > 2 ? std::atoi(argv[2]) : 1000;
+	int max_threads = argc > 3 ? std::atoi(argv[3]) : 0;
+	if (max_threads <= 0) {
+		max_threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	std::cout<<"keys="<<keys<<", 20% insert, 20% erase, 60% contains"<<std::endl;
+	std::cout<<"threads\tglobal mutex ops/s\tlock coupling ops/s"<<std::endl;
+	for (int threads = 1; threads <= max_threads; threads *= 2) {
+		double global = measure<GlobalMutexList>(threads, operations, keys);
+		double coupling = measure<LockCouplingList<int>>(threads, operations, keys);
+		std::cout<<threads<<"\t"<<global<<"\t"<<coupling<<std::endl;
+	}
+	return 0;
+}
+
+static commands::Registrar registrar{"bench_lock_coupling_list", commands::Kind::benchmark, main,
+		"lock coupling vs global lock list", {"20000", "1000", "2"}};
+
+}
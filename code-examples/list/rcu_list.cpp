@@ -0,0 +1,188 @@
+/*
+ * rcu_list.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "rcu_list.h"
+
+#include "../doctest.h"
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace test_rcu_list {
+
+std::atomic<const void*> watched{nullptr};
+std::atomic<bool> watched_destroyed{false};
+
+/**
+ * \brief Value which reports when the watched object is destroyed
+ */
+struct Tracked {
+	int value;
+
+	~Tracked() {
+		if (this == watched.load()) {
+			watched_destroyed = true;
+		}
+	}
+
+	bool operator==(const Tracked& other) const {
+		return value == other.value;
+	}
+};
+
+}
+
+TEST_CASE("[rcu list] - single thread") {
+	RcuList<int> list;
+	CHECK(list.size() == 0);
+	CHECK(list.snapshot().empty());
+
+	list.append(2);
+	list.append(3);
+	list.prepend(1);
+	CHECK(list.size() == 3);
+	CHECK(list.snapshot() == std::vector<int>{1, 2, 3});
+	CHECK(list.contains(2));
+	{
+		std::stringstream s_out;
+		s_out<<list;
+		CHECK(s_out.str() == "[ 1 2 3 ]");
+	}
+
+	SUBCASE("remove") {
+		CHECK(list.remove(2));
+		CHECK_FALSE(list.remove(42));
+		CHECK(list.snapshot() == std::vector<int>{1, 3});
+		CHECK(list.remove(3));
+		list.append(4); // end is updated after removing the last node
+		CHECK(list.snapshot() == std::vector<int>{1, 4});
+		CHECK(list.remove(1));
+		CHECK(list.snapshot() == std::vector<int>{4});
+		CHECK(list.size() == 1);
+	}
+	SUBCASE("remove_if and clear") {
+		CHECK(list.remove_if([](int value) { return value % 2 == 1; }) == 2);
+		CHECK(list.snapshot() == std::vector<int>{2});
+		list.clear();
+		CHECK(list.size() == 0);
+		list.append(5);
+		CHECK(list.snapshot() == std::vector<int>{5});
+	}
+}
+
+TEST_CASE("[rcu list] - removed nodes are freed after readers leave") {
+	RcuList<int> list;
+	list.append(1);
+	list.append(2);
+	EpochDomain::global().synchronize();
+	CHECK(EpochDomain::global().pending() == 0);
+
+	std::atomic<bool> reading{false}, removed{false};
+	std::thread reader([&]() {
+		EpochDomain::ReadGuard guard;
+		reading = true;
+		while (!removed) {
+			std::this_thread::yield();
+		}
+	});
+	while (!reading) {
+		std::this_thread::yield();
+	}
+	list.remove(1);
+	removed = true; // reader is still in its read section until it notices this
+	reader.join();
+	EpochDomain::global().synchronize();
+	CHECK(EpochDomain::global().pending() == 0);
+	CHECK(list.snapshot() == std::vector<int>{2});
+}
+
+TEST_CASE("[rcu list] - a removed node stays alive while a reader is inside") {
+	using test_rcu_list::Tracked;
+	RcuList<Tracked> list;
+	list.append(Tracked{1});
+	list.append(Tracked{2});
+	EpochDomain::global().synchronize();
+	test_rcu_list::watched_destroyed = false;
+
+	std::atomic<bool> synchronized{false};
+	std::thread synchronizer;
+	{
+		EpochDomain::ReadGuard guard;
+		const Tracked* first = nullptr;
+		list.for_each([&first](const Tracked& value) {
+			if (!first) {
+				first = &value;
+			}
+		});
+		REQUIRE(first != nullptr);
+		test_rcu_list::watched = first;
+
+		CHECK(list.remove(Tracked{1}));
+		synchronizer = std::thread{[&synchronized]() {
+			EpochDomain::global().synchronize(); // waits for this read section
+			synchronized = true;
+		}};
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		CHECK_FALSE(synchronized);
+		CHECK_FALSE(test_rcu_list::watched_destroyed);
+		CHECK(EpochDomain::global().pending() >= 1);
+		CHECK(first->value == 1); // the unlinked node is still readable
+	}
+	synchronizer.join();
+	CHECK(synchronized);
+	CHECK(test_rcu_list::watched_destroyed);
+	CHECK(EpochDomain::global().pending() == 0);
+	test_rcu_list::watched = nullptr;
+}
+
+TEST_CASE("[rcu list] - concurrent readers and writers") {
+	// values are appended in increasing order and removed from anywhere, so every traversal must be increasing
+	RcuList<int> list;
+	const int values = 20000;
+	std::atomic<bool> done{false};
+	std::atomic<int> errors{0};
+
+	std::vector<std::thread> readers;
+	for (int i = 0; i < 4; i++) {
+		readers.emplace_back([&]() {
+			while (!done) {
+				int previous = -1;
+				list.for_each([&](int value) {
+					if (value <= previous) {
+						errors++;
+					}
+					previous = value;
+				});
+			}
+		});
+	}
+	std::thread remover([&]() {
+		for (int i = 0; i < values; i += 2) {
+			while (!list.remove(i)) {
+				std::this_thread::yield();
+			}
+		}
+	});
+	for (int i = 0; i < values; i++) {
+		list.append(i);
+	}
+	remover.join();
+	done = true;
+	for (auto& reader: readers) {
+		reader.join();
+	}
+
+	CHECK(errors == 0);
+	CHECK(list.size() == values / 2);
+	auto remaining = list.snapshot();
+	REQUIRE(remaining.size() == values / 2);
+	CHECK(remaining.front() == 1);
+	CHECK(remaining.back() == values - 1);
+}
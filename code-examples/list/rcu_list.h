@@ -0,0 +1,216 @@
+/*
+ * rcu_list.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_LIST_RCU_LIST_H_
+#define CODE_EXAMPLES_LIST_RCU_LIST_H_
+
+#include "../concurrency/epoch.h"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+/**
+ * \brief A node of RcuList
+ *
+ * Same as ListNode, but next is atomic: readers follow it while writers change it.
+ * prev is used only by writers (under the writer mutex).
+ * \see ListNode
+ */
+template<typename T>
+struct RcuListNode {
+	const T value;							/**< Value stored in this node, never changed while the node is in a list */
+	std::atomic<RcuListNode<T>*> next;		/**< Pointer to the next node, nullptr for the last node */
+	RcuListNode<T>* prev;					/**< Pointer to the previous node, nullptr for the first node */
+
+	RcuListNode(const T& value, RcuListNode<T>* prev=nullptr, RcuListNode<T>* next=nullptr): value{value}, next{next}, prev{prev} {}
+};
+
+/**
+ * \brief Read-mostly concurrent doubly linked list (read-copy-update style)
+ *
+ * Readers traverse the list without locks and without atomic read-modify-write operations:
+ * for_each(), contains() and snapshot() only load pointers (acquire) inside an EpochDomain::ReadGuard.
+ * Writers (append, prepend, remove) are serialized with a mutex and publish changes with release stores.
+ * A removed node keeps its next pointer, so readers standing on it continue to the rest of the list;
+ * the node is deleted through epoch-based reclamation after those readers are done.
+ *
+ * Readers see each change atomically, but a traversal running during several changes can see some of them only.
+ * \see DoublyLinkedList
+ */
+template<typename T>
+class RcuList {
+private:
+	std::atomic<RcuListNode<T>*> begin;
+	RcuListNode<T>* end;				/**< Used only by writers */
+	std::atomic<std::size_t> _size;
+	std::mutex writer_mutex;
+
+	/**
+	 * \brief Unlink node (writer mutex must be held) and retire it
+	 */
+	void unlink(RcuListNode<T>* node) {
+		RcuListNode<T>* next = node->next.load(std::memory_order_relaxed);
+		if (node->prev) {
+			node->prev->next.store(next, std::memory_order_release);
+		} else {
+			begin.store(next, std::memory_order_release);
+		}
+		if (next) {
+			next->prev = node->prev;
+		} else {
+			end = node->prev;
+		}
+		_size.store(_size.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+		EpochDomain::global().retire(node);
+	}
+public:
+	RcuList(): begin{nullptr}, end{nullptr}, _size{0} {}
+	RcuList(const RcuList&) = delete;
+	RcuList& operator=(const RcuList&) = delete;
+
+	/**
+	 * \brief Destroys the list, no reader may access it any more
+	 */
+	~RcuList() {
+		this->clear();
+		EpochDomain::global().synchronize();
+	}
+
+	/**
+	 * \brief Append value to the end of this list
+	 *
+	 * The node is fully constructed before it is published with a release store.
+	 */
+	void append(const T& value) {
+		std::lock_guard<std::mutex> lock{writer_mutex};
+		auto new_node = new RcuListNode<T>{value, end};
+		if (end == nullptr) {
+			end = new_node;
+			begin.store(new_node, std::memory_order_release);
+		} else {
+			end->next.store(new_node, std::memory_order_release);
+			end = new_node;
+		}
+		_size.store(_size.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * \brief Insert value at the beginning of this list
+	 */
+	void prepend(const T& value) {
+		std::lock_guard<std::mutex> lock{writer_mutex};
+		RcuListNode<T>* first = begin.load(std::memory_order_relaxed);
+		auto new_node = new RcuListNode<T>{value, nullptr, first};
+		if (first) {
+			first->prev = new_node;
+		} else {
+			end = new_node;
+		}
+		begin.store(new_node, std::memory_order_release);
+		_size.store(_size.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * \brief Remove the first node with this value
+	 *
+	 * Complexity is O(n)
+	 * \return true if a node was removed
+	 */
+	bool remove(const T& value) {
+		std::lock_guard<std::mutex> lock{writer_mutex};
+		for (auto current = begin.load(std::memory_order_relaxed); current; current = current->next.load(std::memory_order_relaxed)) {
+			if (current->value == value) {
+				unlink(current);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * \brief Remove all nodes with values satisfying predicate
+	 * \return number of removed nodes
+	 */
+	template<typename Predicate>
+	std::size_t remove_if(Predicate predicate) {
+		std::lock_guard<std::mutex> lock{writer_mutex};
+		std::size_t removed = 0;
+		auto current = begin.load(std::memory_order_relaxed);
+		while (current) {
+			auto next = current->next.load(std::memory_order_relaxed);
+			if (predicate(current->value)) {
+				unlink(current);
+				removed++;
+			}
+			current = next;
+		}
+		return removed;
+	}
+
+	void clear() {
+		remove_if([](const T&) { return true; });
+	}
+
+	/**
+	 * \brief Call function for each value, from the first to the last
+	 *
+	 * Lock-free reader: safe to call concurrently with writers and other readers.
+	 * function must not modify this list (it would deadlock in synchronize, if called).
+	 */
+	template<typename Function>
+	void for_each(Function function) const {
+		EpochDomain::ReadGuard guard;
+		for (auto current = begin.load(std::memory_order_acquire); current; current = current->next.load(std::memory_order_acquire)) {
+			function(current->value);
+		}
+	}
+
+	/**
+	 * \brief Lock-free search
+	 */
+	bool contains(const T& value) const {
+		EpochDomain::ReadGuard guard;
+		for (auto current = begin.load(std::memory_order_acquire); current; current = current->next.load(std::memory_order_acquire)) {
+			if (current->value == value) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * \brief Copy of the values seen by one lock-free traversal
+	 */
+	std::vector<T> snapshot() const {
+		std::vector<T> result;
+		for_each([&result](const T& value) {
+			result.push_back(value);
+		});
+		return result;
+	}
+
+	/**
+	 * \brief Number of values, may be already outdated when returned
+	 */
+	std::size_t size() const {
+		return _size.load(std::memory_order_relaxed);
+	}
+
+	friend std::ostream& operator<<(std::ostream& out, const RcuList<T>& list) {
+		out<<"[ ";
+		list.for_each([&out](const T& value) {
+			out << value << " ";
+		});
+		out<<"]";
+		return out;
+	}
+};
+
+#endif /* CODE_EXAMPLES_LIST_RCU_LIST_H_ */
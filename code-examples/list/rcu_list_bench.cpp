@@ -0,0 +1,128 @@
+/*
+ * rcu_list_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "rcu_list.h"
+#include "../commands.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+namespace bench_rcu_list {
+
+/**
+ * \brief Baseline: the usual list guarded by a readers-writer lock
+ */
+class SharedMutexList {
+private:
+	std::list<int> values;
+	mutable std::shared_mutex mutex;
+public:
+	void append(int value) {
+		std::unique_lock<std::shared_mutex> lock{mutex};
+		values.push_back(value);
+	}
+
+	bool remove(int value) {
+		std::unique_lock<std::shared_mutex> lock{mutex};
+		auto it = std::find(values.begin(), values.end(), value);
+		if (it == values.end()) {
+			return false;
+		}
+		values.erase(it);
+		return true;
+	}
+
+	template<typename Function>
+	void for_each(Function function) const {
+		std::shared_lock<std::shared_mutex> lock{mutex};
+		for (int value: values) {
+			function(value);
+		}
+	}
+};
+
+/**
+ * \brief Readers traverse the list for duration while one writer replaces a value every writer_pause
+ * \return traversals per second of all readers together
+ */
+template<typename List>
+double measure(List& list, int list_size, int readers, std::chrono::milliseconds duration, std::chrono::microseconds writer_pause) {
+	std::atomic<bool> done{false};
+	std::atomic<long long> traversals{0};
+	std::atomic<long long> checksum{0};
+
+	std::vector<std::thread> threads;
+	for (int i = 0; i < readers; i++) {
+		threads.emplace_back([&]() {
+			long long local_traversals = 0, sum = 0;
+			while (!done.load(std::memory_order_relaxed)) {
+				list.for_each([&sum](int value) {
+					sum += value;
+				});
+				local_traversals++;
+			}
+			traversals += local_traversals;
+			checksum += sum;
+		});
+	}
+	std::thread writer([&]() {
+		int next = list_size;
+		while (!done.load(std::memory_order_relaxed)) {
+			list.remove(next - list_size);
+			list.append(next++);
+			std::this_thread::sleep_for(writer_pause);
+		}
+	});
+
+	std::this_thread::sleep_for(duration);
+	done = true;
+	for (auto& thread: threads) {
+		thread.join();
+	}
+	writer.join();
+	return traversals / std::chrono::duration<double>(duration).count();
+}
+
+// usage: bench_rcu_list [list size] [max readers] [milliseconds per measurement]
+int main(int argc, char** argv) {
+	int list_size = argc > 1 ? std::atoi(argv[1]) : 1000;
+	int max_readers = argc > 2 ? std::atoi(argv[2]) : 0;
+	int milliseconds = argc > 3 ? std::atoi(argv[3]) : 500;
+	if (max_readers <= 0) {
+		max_readers = std::max(1u, std::thread::hardware_concurrency());
+	}
+	auto duration = std::chrono::milliseconds{milliseconds};
+	auto writer_pause = std::chrono::microseconds{100};
+
+	std::cout<<"list size="<<list_size<<", one writer replacing a value every "<<writer_pause.count()<<" us"<<std::endl;
+	std::cout<<"readers\tshared_mutex traversals/s\tRcuList traversals/s"<<std::endl;
+	for (int readers = 1; readers <= max_readers; readers *= 2) {
+		SharedMutexList locked;
+		RcuList<int> rcu;
+		for (int i = 0; i < list_size; i++) {
+			locked.append(i);
+			rcu.append(i);
+		}
+		double locked_rate = measure(locked, list_size, readers, duration, writer_pause);
+		double rcu_rate = measure(rcu, list_size, readers, duration, writer_pause);
+		std::cout<<readers<<"\t"<<locked_rate<<"\t"<<rcu_rate<<std::endl;
+	}
+	return 0;
+}
+
+static commands::Registrar registrar{"bench_rcu_list", commands::Kind::benchmark, main,
+		"RCU list vs shared_mutex list readers", {"1000", "2", "50"}};
+
+}
@@ -0,0 +1,111 @@
+/*
+ * sliding_window.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "sliding_window.h"
+#include "../perf/alloc_counter.h"
+
+#include "../doctest.h"
+
+#include <algorithm>
+#include <deque>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+TEST_CASE("[sliding window] - push and evict") {
+	CHECK_THROWS_AS(SlidingWindow<int>{0}, std::invalid_argument);
+
+	SlidingWindow<int> window{3};
+	CHECK(window.empty());
+	CHECK(window.capacity() == 3);
+	CHECK(window.sum() == 0);
+	CHECK_THROWS_AS(window.min(), std::out_of_range);
+	CHECK_THROWS_AS(window.pop_front(), std::out_of_range);
+
+	window.push(5);
+	window.push(1);
+	window.push(3);
+	CHECK(window.full());
+	CHECK(window.sum() == 9);
+	CHECK(window.min() == 1);
+	CHECK(window.max() == 5);
+
+	window.push(4); // evicts 5
+	CHECK(window.size() == 3);
+	CHECK(window.front() == 1);
+	CHECK(window.back() == 4);
+	CHECK(window[1] == 3);
+	CHECK_THROWS_AS(window[3], std::out_of_range);
+	CHECK(window.sum() == 8);
+	CHECK(window.max() == 4);
+	{
+		std::stringstream s_out;
+		s_out<<window;
+		CHECK(s_out.str() == "[ 1 3 4 ]");
+	}
+
+	CHECK(window.pop_front() == 1);
+	CHECK(window.min() == 3);
+	CHECK(window.evict_while([](int value) { return value < 4; }) == 1);
+	CHECK(window.size() == 1);
+	CHECK(window.min() == 4);
+	CHECK(window.max() == 4);
+	CHECK(window.total_pushed() == 4);
+
+	window.clear();
+	CHECK(window.empty());
+	window.push(7);
+	CHECK(window.sum() == 7);
+	CHECK(window.min() == 7);
+}
+
+TEST_CASE("[sliding window] - aggregates match recomputation") {
+	std::mt19937 random{86};
+	for (std::size_t capacity: {1, 2, 7, 64}) {
+		SlidingWindow<long long> window{capacity};
+		std::deque<long long> expected;
+		int mismatches = 0;
+		for (int step = 0; step < 5000; step++) {
+			if (random() % 5 == 0 && !expected.empty()) {
+				if (window.pop_front() != expected.front()) {
+					mismatches++;
+				}
+				expected.pop_front();
+			} else {
+				long long value = random() % 100; // duplicates on purpose
+				window.push(value);
+				expected.push_back(value);
+				if (expected.size() > capacity) {
+					expected.pop_front();
+				}
+			}
+			if (window.size() != expected.size()) {
+				mismatches++;
+			} else if (!expected.empty()) {
+				if (window.sum() != std::accumulate(expected.begin(), expected.end(), 0LL) ||
+						window.min() != *std::min_element(expected.begin(), expected.end()) ||
+						window.max() != *std::max_element(expected.begin(), expected.end()) ||
+						window.front() != expected.front() || window.back() != expected.back()) {
+					mismatches++;
+				}
+			}
+		}
+		CHECK(mismatches == 0);
+	}
+}
+
+TEST_CASE("[sliding window] - slots are reused") {
+	SlidingWindow<double> window{100};
+	auto before = alloc_counter::total();
+	for (int i = 0; i < 10000; i++) {
+		window.push(i * 0.5);
+	}
+	CHECK((alloc_counter::total() - before).allocations == 0);
+	CHECK(window.min() == 9900 * 0.5);
+	CHECK(window.max() == 9999 * 0.5);
+}
@@ -0,0 +1,269 @@
+/*
+ * sliding_window.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_LIST_SLIDING_WINDOW_H_
+#define CODE_EXAMPLES_LIST_SLIDING_WINDOW_H_
+
+#include <cstddef>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * \brief The last values of a stream, in a ring buffer of fixed capacity
+ *
+ * Replaces a DoublyLinkedList used as a window (append, then pop_front of old values): slots are allocated once
+ * and reused, push() overwrites the oldest value when the window is full. push() and pop_front() are O(1)
+ * (amortized for min/max), sum(), min() and max() of the window are O(1).
+ *
+ * min() and max() use monotonic queues of slot indices: a value which is larger (smaller) than a later one
+ * can never be the minimum (maximum) again, so it is dropped; queue fronts are the answers.
+ * Indices wrap around with a comparison, not with %, which would cost a division per step.
+ * The sum is updated incrementally, for floating point values it accumulates rounding errors.
+ * \tparam T value with operator+, operator-, operator< and T{} as zero
+ */
+template<typename T>
+class SlidingWindow {
+private:
+	/**
+	 * \brief index + offset in a ring of capacity slots, offset < capacity
+	 */
+	static std::size_t wrap(std::size_t index, std::size_t offset, std::size_t capacity) {
+		index += offset;
+		return index >= capacity ? index - capacity : index;
+	}
+
+	/**
+	 * \brief Deque of slot indices in a ring buffer, never longer than the window
+	 */
+	class MonotonicQueue {
+	private:
+		std::vector<std::size_t> items;
+		std::size_t head = 0;
+		std::size_t count = 0;
+	public:
+		explicit MonotonicQueue(std::size_t capacity): items(capacity) {}
+
+		bool empty() const {
+			return count == 0;
+		}
+
+		std::size_t front() const {
+			return items[head];
+		}
+
+		std::size_t back() const {
+			return items[wrap(head, count - 1, items.size())];
+		}
+
+		void push_back(std::size_t slot) {
+			items[wrap(head, count, items.size())] = slot;
+			count++;
+		}
+
+		void pop_back() {
+			count--;
+		}
+
+		void pop_front() {
+			head = wrap(head, 1, items.size());
+			count--;
+		}
+
+		void clear() {
+			head = count = 0;
+		}
+	};
+
+	std::vector<T> slots;
+	std::size_t head = 0;					/**< Slot of the oldest value */
+	std::size_t _size = 0;
+	unsigned long long pushed = 0;
+	T _sum{};
+	MonotonicQueue min_queue;				/**< Values increase from front to back */
+	MonotonicQueue max_queue;				/**< Values decrease from front to back */
+
+	const T& at(std::size_t index) const {
+		return slots[wrap(head, index, slots.size())];
+	}
+
+	void check_not_empty(const char* operation) const {
+		if (_size == 0) {
+			throw std::out_of_range{std::string{operation} + " of empty window"};
+		}
+	}
+public:
+	/**
+	 * \param capacity maximum number of values in the window
+	 * \throw std::invalid_argument if capacity is 0
+	 */
+	explicit SlidingWindow(std::size_t capacity): slots(capacity > 0 ? capacity : throw std::invalid_argument{"window capacity must be positive"}),
+		min_queue{capacity}, max_queue{capacity} {}
+
+	/**
+	 * \brief Add value as the newest, evicting the oldest value if the window is full
+	 *
+	 * Complexity is amortized O(1), no allocations.
+	 * \post size() is min(size() + 1, capacity())
+	 */
+	void push(const T& value) {
+		if (_size == slots.size()) {
+			pop_front();
+		}
+		std::size_t slot = wrap(head, _size, slots.size());
+		slots[slot] = value;
+		_size++;
+		pushed++;
+		_sum = _sum + value;
+
+		while (!min_queue.empty() && !(slots[min_queue.back()] < value)) {
+			min_queue.pop_back();
+		}
+		min_queue.push_back(slot);
+		while (!max_queue.empty() && !(value < slots[max_queue.back()])) {
+			max_queue.pop_back();
+		}
+		max_queue.push_back(slot);
+	}
+
+	/**
+	 * \brief Evict the oldest value
+	 *
+	 * Complexity is O(1)
+	 * \throw std::out_of_range if the window is empty
+	 * \return evicted value
+	 */
+	T pop_front() {
+		check_not_empty("pop_front");
+		std::size_t slot = head;
+		T value = slots[slot];
+		head = wrap(head, 1, slots.size());
+		_size--;
+		_sum = _sum - value;
+		// the queues hold slots of values in the window only, so the slot identifies the evicted value
+		if (min_queue.front() == slot) {
+			min_queue.pop_front();
+		}
+		if (max_queue.front() == slot) {
+			max_queue.pop_front();
+		}
+		return value;
+	}
+
+	/**
+	 * \brief Evict oldest values while predicate(oldest value) is true, e.g. events older than a time limit
+	 * \return number of evicted values
+	 */
+	template<typename Predicate>
+	std::size_t evict_while(Predicate predicate) {
+		std::size_t evicted = 0;
+		while (_size > 0 && predicate(front())) {
+			pop_front();
+			evicted++;
+		}
+		return evicted;
+	}
+
+	void clear() {
+		head = _size = 0;
+		_sum = T{};
+		min_queue.clear();
+		max_queue.clear();
+	}
+
+	/**
+	 * \brief Oldest value
+	 * \throw std::out_of_range if the window is empty
+	 */
+	const T& front() const {
+		check_not_empty("front");
+		return slots[head];
+	}
+
+	/**
+	 * \brief Newest value
+	 * \throw std::out_of_range if the window is empty
+	 */
+	const T& back() const {
+		check_not_empty("back");
+		return at(_size - 1);
+	}
+
+	/**
+	 * \brief Access values by age, 0 is the oldest
+	 *
+	 * Complexity is O(1)
+	 * \throw std::out_of_range if index is not less than size()
+	 */
+	const T& operator[](std::size_t index) const {
+		if (index >= _size) {
+			throw std::out_of_range{"index="+std::to_string(index)+" larger than window size="+std::to_string(_size)};
+		}
+		return at(index);
+	}
+
+	/**
+	 * \brief Sum of the values in the window, T{} if it is empty
+	 */
+	const T& sum() const {
+		return _sum;
+	}
+
+	/**
+	 * \throw std::out_of_range if the window is empty
+	 */
+	const T& min() const {
+		check_not_empty("min");
+		return slots[min_queue.front()];
+	}
+
+	/**
+	 * \throw std::out_of_range if the window is empty
+	 */
+	const T& max() const {
+		check_not_empty("max");
+		return slots[max_queue.front()];
+	}
+
+	std::size_t size() const {
+		return _size;
+	}
+
+	std::size_t capacity() const {
+		return slots.size();
+	}
+
+	bool empty() const {
+		return _size == 0;
+	}
+
+	bool full() const {
+		return _size == slots.size();
+	}
+
+	/**
+	 * \brief Number of values pushed since the window was created
+	 */
+	unsigned long long total_pushed() const {
+		return pushed;
+	}
+
+	/**
+	 * \brief Prints values from the oldest to the newest, same format as DoublyLinkedList
+	 */
+	friend std::ostream& operator<<(std::ostream& out, const SlidingWindow<T>& window) {
+		out<<"[ ";
+		for (std::size_t i = 0; i < window._size; i++) {
+			out << window.at(i) << " ";
+		}
+		out<<"]";
+		return out;
+	}
+};
+
+#endif /* CODE_EXAMPLES_LIST_SLIDING_WINDOW_H_ */
@@ -0,0 +1,86 @@
+/*
+ * sliding_window_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "list.h"
+#include "sliding_window.h"
+#include "../perf/alloc_counter.h"
+#include "../commands.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace bench_sliding_window {
+
+/**
+ * \brief Event values: a cheap pseudo-random stream
+ */
+struct Events {
+	unsigned long long state = 88172645463325252ULL;
+
+	long long next() {
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return static_cast<long long>(state % 1000000);
+	}
+};
+
+template<typename Function>
+void measure(const char* name, long long events, Function function) {
+	auto before = alloc_counter::total();
+	auto begin = std::chrono::steady_clock::now();
+	long long checksum = function();
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - begin;
+	auto used = alloc_counter::total() - before;
+	std::cout<<name<<"\t"<<elapsed.count() / events<<"\t"<<double(used.allocations) / events<<"\t"<<checksum<<std::endl;
+}
+
+// usage: bench_sliding_window [events] [window]
+int main(int argc, char** argv) {
+	long long events = argc > 1 ? std::atoll(argv[1]) : 100000000;
+	std::size_t window_size = argc > 2 ? std::atol(argv[2]) : 100000;
+
+	std::cout<<events<<" events, window of "<<window_size<<std::endl;
+	std::cout<<"container\tns/event\tallocations/event\tchecksum"<<std::endl;
+
+	// what we had: append, pop_front the oldest, running sum only (min/max would need a scan of the window)
+	measure("DoublyLinkedList, sum", events, [&]() {
+		Events stream;
+		DoublyLinkedList<long long> list;
+		long long sum = 0;
+		long long checksum = 0;
+		for (long long i = 0; i < events; i++) {
+			long long value = stream.next();
+			list.append(value);
+			sum += value;
+			if (list.size() > window_size) {
+				sum -= list.pop_front();
+			}
+			checksum += sum;
+		}
+		return checksum;
+	});
+
+	// random values make the loops of the monotonic queues unpredictable, sorted input is about 3x faster
+	measure("SlidingWindow, sum+min+max", events, [&]() {
+		Events stream;
+		SlidingWindow<long long> window{window_size};
+		long long checksum = 0;
+		for (long long i = 0; i < events; i++) {
+			window.push(stream.next());
+			checksum += window.sum() + window.min() - window.max();
+		}
+		return checksum;
+	});
+	return 0;
+}
+
+static commands::Registrar registrar{"bench_sliding_window", commands::Kind::benchmark, main,
+		"DoublyLinkedList window vs SlidingWindow ring buffer", {"2000000", "10000"}};
+
+}
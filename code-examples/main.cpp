@@ -4,16 +4,14 @@
  *  Created on: Sep 11, 2020
  *      Author: KZ
  */
-// unit_doctest unit_catch
-// lecture2_08_09_20
+// Entry points register themselves (see commands.h) and are chosen by the first argument:
+//   code-examples list                  all commands: unit_doctest, unit_catch, examples and benchmarks
+//   code-examples bench_list_views      a single command, the rest of the arguments are its own
+//   code-examples bench --json=b.json   all benchmarks with warmup and repetitions
+// Without a command name all arguments go to unit_doctest.
 
-#define current_ns unit_doctest
-
-namespace current_ns {
-	int main(int argc, char** argv);
-}
+#include "commands.h"
 
 int main(int argc, char** argv) {
-	return current_ns::main(argc, argv);
+	return commands::Registry::global().run(argc, argv, "unit_doctest");
 }
-
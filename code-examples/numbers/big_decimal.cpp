@@ -0,0 +1,216 @@
+/*
+ * big_decimal.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "big_unsigned.h"
+#include "big_limbs.h"
+
+#include <charconv>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+
+namespace {
+
+using big_limbs::Limb;
+
+constexpr std::size_t chunk_digits = 19;
+constexpr Limb chunk = 10000000000000000000ULL;	/**< 10^19, the largest power of 10 in a limb */
+constexpr std::size_t leaf_limbs = 32;			/**< numbers up to this size are converted 19 digits at a time */
+constexpr std::size_t leaf_digits = 608;		/**< 32 * 19 */
+
+constexpr std::size_t guard_bits = 64;			/**< extra bits of the inverses */
+
+/**
+ * \brief 2^e / d off by a few units, from an estimate x with about half of the bits correct
+ *
+ * Newton's iteration x + x (2^e - d x) / 2^e doubles the correct bits. The exact floor would need
+ * another product d x, the Barrett division in append_digits corrects its quotient anyway.
+ */
+BigUnsigned refine_reciprocal(const BigUnsigned& d, BigUnsigned x, std::size_t e) {
+	const BigUnsigned one = BigUnsigned{1} << e;
+	BigUnsigned product = d * x;
+	bool below = product <= one;
+	BigUnsigned error = below ? one - product : product - one;
+	// the correction x error / 2^e has about half the bits of x, only that many (and a limb) of both factors matter
+	std::size_t x_bits = x.bit_length();
+	std::size_t error_bits = error.bit_length();
+	std::size_t keep = (x_bits + error_bits > e ? x_bits + error_bits - e : 0) + 64;
+	std::size_t x_shift = x_bits > keep ? x_bits - keep : 0;
+	std::size_t error_shift = error_bits > keep ? error_bits - keep : 0;
+	BigUnsigned correction = ((x >> x_shift) * (error >> error_shift)) >> (e - x_shift - error_shift);
+	if (below) {
+		x += correction;
+	} else {
+		x -= correction;
+	}
+	return x;
+}
+
+/**
+ * \brief 10^(19 * 2^level) and what dividing by it needs
+ */
+struct Power {
+	BigUnsigned value;
+	std::size_t digits;
+	std::size_t bits;
+	BigUnsigned inverse;	/**< About 2^(2 bits + guard_bits) / value, computed when first dividing by this power */
+};
+
+std::mutex powers_mutex;
+std::deque<Power> powers; // a deque keeps references to the elements valid while it grows
+
+/**
+ * \brief The table of powers grows as needed and is shared by all threads
+ * \param with_inverse compute the inverse too (to_string needs it, from_string doesn't)
+ */
+const Power& power(std::size_t level, bool with_inverse) {
+	std::lock_guard<std::mutex> lock{powers_mutex};
+	while (powers.size() <= level) {
+		Power next;
+		if (powers.empty()) {
+			next.value = chunk;
+			next.digits = chunk_digits;
+		} else {
+			next.value = powers.back().value * powers.back().value;
+			next.digits = 2 * powers.back().digits;
+		}
+		next.bits = next.value.bit_length();
+		powers.push_back(std::move(next));
+	}
+	// the division needs the inverses of the lower levels anyway, and the square of the inverse
+	// of the previous level is a good estimate for this one: a single Newton step is enough.
+	// Without the guard bits the error of a few units would grow quadratically from level to level.
+	for (std::size_t i = 0; with_inverse && i <= level; i++) {
+		Power& current = powers[i];
+		if (!current.inverse.is_zero()) {
+			continue;
+		}
+		const std::size_t e = 2 * current.bits + guard_bits;
+		if (i == 0) {
+			current.inverse = BigUnsigned{1} << e;
+			current.inverse.divide(chunk);
+		} else {
+			// (2^(2b + g) / p)^2 = 2^(4b + 2g) / value
+			const Power& previous = powers[i - 1];
+			BigUnsigned estimate = previous.inverse * previous.inverse;
+			current.inverse = refine_reciprocal(current.value, estimate >> (4 * previous.bits + 2 * guard_bits - e), e);
+		}
+	}
+	return powers[level];
+}
+
+/**
+ * \brief Appends the digits of value (at most 19), padded with zeros to width unless width is 0
+ */
+void append_chunk(std::string& out, Limb value, std::size_t width) {
+	char buffer[chunk_digits + 1];
+	auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+	std::size_t length = static_cast<std::size_t>(result.ptr - buffer);
+	if (width > length) {
+		out.append(width - length, '0');
+	}
+	out.append(buffer, length);
+}
+
+/**
+ * \brief Digits of a small number, 19 at a time from the lowest
+ */
+void append_leaf(std::string& out, const BigUnsigned& value, std::size_t width) {
+	std::vector<Limb> quotient = value.get_limbs();
+	std::vector<Limb> chunks;
+	while (!quotient.empty()) {
+		chunks.push_back(big_limbs::divmod_1(quotient.data(), quotient.size(), chunk));
+		big_limbs::normalize(quotient);
+	}
+	std::size_t length = chunks.empty() ? 0 : (chunks.size() - 1) * chunk_digits + std::to_string(chunks.back()).size();
+	if (width > length) {
+		out.append(width - length, '0');
+	} else if (chunks.empty()) {
+		out += '0';
+	}
+	for (std::size_t i = chunks.size(); i-- > 0;) {
+		append_chunk(out, chunks[i], i + 1 == chunks.size() ? 0 : chunk_digits);
+	}
+}
+
+/**
+ * \brief value = high 10^d + low with the power 10^d whose square is above value, both halves recursively
+ * \param width number of digits to write with leading zeros, 0 for the top level
+ */
+void append_digits(std::string& out, const BigUnsigned& value, std::size_t width) {
+	if (value.get_limbs().size() <= leaf_limbs) {
+		append_leaf(out, value, width);
+		return;
+	}
+	// the smallest power with value below its square (the next power): both parts are below the power
+	std::size_t level = 0;
+	while (!(value < power(level + 1, false).value)) {
+		level++;
+	}
+	const Power& divisor = power(level, true);
+	// Barrett: the low bits of value don't change the estimate much (it is a few units off the quotient),
+	// dropping them halves the product
+	BigUnsigned high = ((value >> (divisor.bits - 1)) * divisor.inverse) >> (divisor.bits + 1 + guard_bits);
+	BigUnsigned product = high * divisor.value;
+	while (product > value) {
+		high -= 1;
+		product -= divisor.value;
+	}
+	BigUnsigned low = value - product;
+	while (low >= divisor.value) {
+		low -= divisor.value;
+		high += 1;
+	}
+	append_digits(out, high, width > divisor.digits ? width - divisor.digits : 0);
+	append_digits(out, low, divisor.digits);
+}
+
+BigUnsigned parse_leaf(const char* digits, std::size_t length) {
+	BigUnsigned value;
+	std::size_t first = length % chunk_digits ? length % chunk_digits : chunk_digits;
+	for (std::size_t position = 0; position < length; position += first, first = chunk_digits) {
+		Limb part = 0;
+		std::from_chars(digits + position, digits + position + first, part);
+		value *= chunk; // the first part goes into zero
+		value += part;
+	}
+	return value;
+}
+
+BigUnsigned parse(const char* digits, std::size_t length) {
+	if (length <= leaf_digits) {
+		return parse_leaf(digits, length);
+	}
+	// the lower part gets between half and all but one of the digits
+	std::size_t level = 1;
+	while (2 * power(level, false).digits < length) {
+		level++;
+	}
+	const Power& multiplier = power(level, false);
+	std::size_t low_digits = multiplier.digits;
+	return parse(digits, length - low_digits) * multiplier.value + parse(digits + length - low_digits, low_digits);
+}
+
+}
+
+std::string BigUnsigned::to_string() const {
+	std::string digits;
+	append_digits(digits, *this, 0);
+	return digits;
+}
+
+BigUnsigned BigUnsigned::from_string(const std::string& digits) {
+	if (digits.empty()) {
+		throw std::invalid_argument("no digits");
+	}
+	for (char digit: digits) {
+		if (digit < '0' || digit > '9') {
+			throw std::invalid_argument("not a decimal digit in " + digits.substr(0, 40));
+		}
+	}
+	return parse(digits.data(), digits.size());
+}
@@ -0,0 +1,98 @@
+/*
+ * big_decimal_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "big_unsigned.h"
+#include "../commands.h"
+
+#ifdef GMP_ENABLED
+#include <gmp.h>
+#endif
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace bench_decimal {
+
+template<typename Function>
+double seconds(Function function) {
+	auto begin = std::chrono::steady_clock::now();
+	function();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+/**
+ * \brief Digits 19 at a time from the lowest, a division of the whole number for every 19 digits
+ */
+std::string quadratic_to_string(const BigUnsigned& value) {
+	BigUnsigned quotient = value;
+	std::vector<std::uint64_t> chunks;
+	while (!quotient.is_zero()) {
+		chunks.push_back(quotient.divide(10000000000000000000ULL));
+	}
+	std::string digits = chunks.empty() ? "0" : std::to_string(chunks.back());
+	for (std::size_t i = chunks.size() - 1; i-- > 0;) {
+		std::string part = std::to_string(chunks[i]);
+		digits.append(19 - part.size(), '0');
+		digits += part;
+	}
+	return digits;
+}
+
+// usage: bench_decimal [max digits]
+// random numbers of 1e5, 1e6, 1e7 digits up to max digits, times in seconds;
+// the quadratic conversion is only measured up to 1e5 digits
+int main(int argc, char** argv) {
+	std::size_t max_digits = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+	std::mt19937_64 random{97};
+
+	std::cout<<"digits\tto_string\tfrom_string\tquadratic to_string";
+#ifdef GMP_ENABLED
+	std::cout<<"\tgmp get_str\tgmp set_str";
+#endif
+	std::cout<<std::endl;
+	for (std::size_t digit_count = 100000; digit_count <= max_digits; digit_count *= 10) {
+		std::string digits(digit_count, '0');
+		digits[0] = static_cast<char>('1' + random() % 9);
+		for (std::size_t i = 1; i < digit_count; i++) {
+			digits[i] = static_cast<char>('0' + random() % 10);
+		}
+
+		BigUnsigned value;
+		double parse_seconds = seconds([&]() { value = BigUnsigned::from_string(digits); });
+		std::string printed;
+		double print_seconds = seconds([&]() { printed = value.to_string(); });
+		if (printed != digits) {
+			std::cout<<digit_count<<"\tround trip failed"<<std::endl;
+			return 1;
+		}
+		std::cout<<digit_count<<"\t"<<print_seconds<<"\t"<<parse_seconds<<"\t";
+		if (digit_count <= 100000) {
+			std::cout<<seconds([&]() { printed = quadratic_to_string(value); });
+		} else {
+			std::cout<<"-";
+		}
+#ifdef GMP_ENABLED
+		mpz_t number;
+		mpz_init(number);
+		std::cout<<"\t"<<seconds([&]() { mpz_set_str(number, digits.c_str(), 10); });
+		std::vector<char> buffer(digit_count + 2);
+		std::cout<<"\t"<<seconds([&]() { mpz_get_str(buffer.data(), 10, number); });
+		mpz_clear(number);
+#endif
+		std::cout<<std::endl;
+	}
+	return 0;
+}
+
+static commands::Registrar registrar{"bench_decimal", commands::Kind::benchmark, main,
+		"BigUnsigned decimal conversion of 1e5 to 1e7 digit numbers", {"100000"}};
+
+}
@@ -0,0 +1,85 @@
+/*
+ * big_decimal_test.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "big_unsigned.h"
+
+#include "../doctest.h"
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace test_big_decimal {
+
+/**
+ * \brief Digits by repeated division by 10, the obviously correct reference
+ */
+std::string slow_digits(BigUnsigned value) {
+	if (value.is_zero()) {
+		return "0";
+	}
+	std::string digits;
+	while (!value.is_zero()) {
+		digits.insert(digits.begin(), static_cast<char>('0' + value.divide(10)));
+	}
+	return digits;
+}
+
+}
+
+TEST_CASE("[big decimal] - small numbers") {
+	CHECK(BigUnsigned{0}.to_string() == "0");
+	CHECK(BigUnsigned{UINT64_MAX}.to_string() == "18446744073709551615");
+	CHECK(BigUnsigned::from_string("0").is_zero());
+	CHECK(BigUnsigned::from_string("000000000000000000000000000000042") == 42);
+	CHECK(BigUnsigned::from_string("18446744073709551616") == BigUnsigned{UINT64_MAX} + 1);
+	CHECK_THROWS_AS(BigUnsigned::from_string(""), std::invalid_argument);
+	CHECK_THROWS_AS(BigUnsigned::from_string("12a"), std::invalid_argument);
+	CHECK_THROWS_AS(BigUnsigned::from_string("-1"), std::invalid_argument);
+}
+
+TEST_CASE("[big decimal] - shifts") {
+	BigUnsigned one{1};
+	CHECK((one << 64).get_limbs() == std::vector<std::uint64_t>{0, 1});
+	CHECK((one << 130 >> 129) == 2);
+	CHECK((BigUnsigned{0xF0} >> 4) == 0xF);
+	CHECK((BigUnsigned{5} >> 200).is_zero());
+	CHECK((BigUnsigned{} << 10).is_zero());
+}
+
+TEST_CASE("[big decimal] - powers of ten and nines across the split sizes") {
+	// zeros in the lower halves must be padded, nines make every division estimate a near miss
+	for (std::size_t digits: {18, 19, 20, 607, 608, 609, 1216, 5000, 20000}) {
+		CAPTURE(digits);
+		std::string power = "1" + std::string(digits, '0');
+		std::string nines(digits, '9');
+		BigUnsigned value = BigUnsigned::from_string(power);
+		CHECK(value.to_string() == power);
+		CHECK((value - 1).to_string() == nines);
+		CHECK(BigUnsigned::from_string(nines) + 1 == value);
+	}
+}
+
+TEST_CASE("[big decimal] - random numbers round trip") {
+	std::mt19937_64 random{97};
+	for (std::size_t limbs: {1, 2, 31, 32, 33, 64, 100, 257, 1000}) {
+		CAPTURE(limbs);
+		std::vector<std::uint64_t> values(limbs);
+		for (std::uint64_t& value: values) {
+			value = random();
+		}
+		BigUnsigned number = BigUnsigned::from_limbs(values);
+		std::string digits = number.to_string();
+		if (limbs <= 257) {
+			CHECK(digits == test_big_decimal::slow_digits(number));
+		}
+		CHECK(BigUnsigned::from_string(digits) == number);
+	}
+	CHECK(BigUnsigned::factorial(3000).to_string().size() == 9131);
+}
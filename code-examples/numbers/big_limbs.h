@@ -0,0 +1,166 @@
+/*
+ * big_limbs.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_NUMBERS_BIG_LIMBS_H_
+#define CODE_EXAMPLES_NUMBERS_BIG_LIMBS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * \brief Arithmetic on little endian arrays of 64-bit limbs, the building blocks of BigUnsigned
+ *
+ * Sizes are passed explicitly, so the functions work on parts of longer numbers (halves in Karatsuba).
+ * Results may alias the first operand unless noted.
+ */
+namespace big_limbs {
+
+using Limb = std::uint64_t;
+using Wide = unsigned __int128;
+using Limbs = std::vector<Limb>;
+
+/**
+ * \brief Size without the leading zero limbs
+ */
+inline std::size_t normalized_size(const Limb* a, std::size_t n) {
+	while (n > 0 && a[n - 1] == 0) {
+		n--;
+	}
+	return n;
+}
+
+inline void normalize(Limbs& a) {
+	a.resize(normalized_size(a.data(), a.size()));
+}
+
+/**
+ * \brief -1, 0 or 1, both sizes must be normalized
+ */
+inline int compare(const Limb* a, std::size_t an, const Limb* b, std::size_t bn) {
+	if (an != bn) {
+		return an < bn ? -1 : 1;
+	}
+	for (std::size_t i = an; i-- > 0;) {
+		if (a[i] != b[i]) {
+			return a[i] < b[i] ? -1 : 1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * \brief r[0, an) = a + b for an >= bn
+ * \return carry out of r[an - 1]
+ */
+inline Limb add(Limb* r, const Limb* a, std::size_t an, const Limb* b, std::size_t bn) {
+	Limb carry = 0;
+	std::size_t i = 0;
+	for (; i < bn; i++) {
+		Wide sum = Wide{a[i]} + b[i] + carry;
+		r[i] = static_cast<Limb>(sum);
+		carry = static_cast<Limb>(sum >> 64);
+	}
+	for (; i < an; i++) {
+		r[i] = a[i] + carry;
+		carry = carry && r[i] == 0;
+	}
+	return carry;
+}
+
+/**
+ * \brief r[0, an) = a - b for an >= bn
+ * \return borrow, 1 if b > a
+ */
+inline Limb sub(Limb* r, const Limb* a, std::size_t an, const Limb* b, std::size_t bn) {
+	Limb borrow = 0;
+	std::size_t i = 0;
+	for (; i < bn; i++) {
+		Limb difference = a[i] - b[i];
+		Limb next_borrow = (a[i] < b[i]) | (difference < borrow);
+		r[i] = difference - borrow;
+		borrow = next_borrow;
+	}
+	for (; i < an; i++) {
+		Limb limb = a[i]; // r may alias a
+		r[i] = limb - borrow;
+		borrow = borrow && limb == 0;
+	}
+	return borrow;
+}
+
+/**
+ * \brief r[0, rn) += b[0, bn) for rn >= bn, the sum must fit into rn limbs
+ */
+inline void add_into(Limb* r, std::size_t rn, const Limb* b, std::size_t bn) {
+	Limb carry = add(r, r, bn, b, bn);
+	for (std::size_t i = bn; carry && i < rn; i++) {
+		carry = ++r[i] == 0;
+	}
+}
+
+/**
+ * \brief r[0, rn) -= b[0, bn) for rn >= bn, the difference must not be negative
+ */
+inline void sub_from(Limb* r, std::size_t rn, const Limb* b, std::size_t bn) {
+	Limb borrow = 0;
+	for (std::size_t i = 0; i < bn; i++) {
+		Limb difference = r[i] - b[i];
+		Limb next_borrow = (r[i] < b[i]) | (difference < borrow);
+		r[i] = difference - borrow;
+		borrow = next_borrow;
+	}
+	for (std::size_t i = bn; borrow && i < rn; i++) {
+		borrow = r[i]-- == 0;
+	}
+}
+
+/**
+ * \brief r[0, n) = a * b
+ * \return the high limb of the product
+ */
+inline Limb mul_1(Limb* r, const Limb* a, std::size_t n, Limb b) {
+	Limb carry = 0;
+	for (std::size_t i = 0; i < n; i++) {
+		Wide product = Wide{a[i]} * b + carry;
+		r[i] = static_cast<Limb>(product);
+		carry = static_cast<Limb>(product >> 64);
+	}
+	return carry;
+}
+
+/**
+ * \brief r[0, n) += a * b, r must not overlap a
+ * \return carry out of r[n - 1]
+ */
+inline Limb addmul_1(Limb* r, const Limb* a, std::size_t n, Limb b) {
+	Limb carry = 0;
+	for (std::size_t i = 0; i < n; i++) {
+		Wide product = Wide{a[i]} * b + r[i] + carry;
+		r[i] = static_cast<Limb>(product);
+		carry = static_cast<Limb>(product >> 64);
+	}
+	return carry;
+}
+
+/**
+ * \brief a[0, n) /= divisor
+ * \return the remainder
+ */
+inline Limb divmod_1(Limb* a, std::size_t n, Limb divisor) {
+	Wide remainder = 0;
+	for (std::size_t i = n; i-- > 0;) {
+		Wide current = (remainder << 64) | a[i];
+		a[i] = static_cast<Limb>(current / divisor);
+		remainder = current % divisor;
+	}
+	return static_cast<Limb>(remainder);
+}
+
+}
+
+#endif /* CODE_EXAMPLES_NUMBERS_BIG_LIMBS_H_ */
@@ -0,0 +1,528 @@
+/*
+ * big_multiplication.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "big_unsigned.h"
+#include "big_limbs.h"
+
+#include <algorithm>
+#include <chrono>
+#include <ostream>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+namespace big_multiplication {
+
+namespace {
+
+using namespace big_limbs;
+
+void multiply(Limb* r, const Limb* a, std::size_t an, const Limb* b, std::size_t bn, Algorithm algorithm);
+
+/**
+ * \brief r[0, an + bn) = a * b, r must not overlap a or b, an >= bn >= 1
+ */
+void multiply(Limb* r, const Limb* a, std::size_t an, const Limb* b, std::size_t bn) {
+	multiply(r, a, an, b, bn, Algorithm::automatic);
+}
+
+/**
+ * \brief Same as multiply(), but the operands may come in any order and may be empty
+ */
+void multiply_any(Limb* r, const Limb* a, std::size_t an, const Limb* b, std::size_t bn) {
+	if (an < bn) {
+		std::swap(a, b);
+		std::swap(an, bn);
+	}
+	if (bn == 0) {
+		std::fill(r, r + an, 0);
+		return;
+	}
+	multiply(r, a, an, b, bn);
+}
+
+void schoolbook(Limb* r, const Limb* a, std::size_t an, const Limb* b, std::size_t bn) {
+	r[an] = mul_1(r, a, an, b[0]);
+	for (std::size_t i = 1; i < bn; i++) {
+		r[an + i] = addmul_1(r + i, a, an, b[i]);
+	}
+}
+
+/**
+ * \brief a much longer than b: products of b with pieces of a of b's length
+ */
+void unbalanced(Limb* r, const Limb* a, std::size_t an, const Limb* b, std::size_t bn) {
+	std::fill(r, r + an + bn, 0);
+	Limbs product(2 * bn);
+	for (std::size_t offset = 0; offset < an; offset += bn) {
+		std::size_t piece = std::min(bn, an - offset);
+		multiply_any(product.data(), a + offset, piece, b, bn);
+		add_into(r + offset, an + bn - offset, product.data(), piece + bn);
+	}
+}
+
+/**
+ * \brief a = a0 + a1 X, b = b0 + b1 X with X = 2^(64h): a*b = z0 + ((a0 + a1)(b0 + b1) - z0 - z2) X + z2 X^2,
+ * three half size products instead of four
+ */
+void karatsuba(Limb* r, const Limb* a, std::size_t an, const Limb* b, std::size_t bn) {
+	if (an >= 2 * bn) {
+		unbalanced(r, a, an, b, bn);
+		return;
+	}
+	const bool square = a == b && an == bn;
+	const std::size_t h = (an + 1) / 2;
+	const std::size_t a1n = an - h;
+	const std::size_t b1n = bn - h;
+	if (bn <= h) { // b has no upper half: a0 b + a1 b X
+		unbalanced(r, a, an, b, bn);
+		return;
+	}
+	multiply_any(r, a, h, b, h);
+	multiply_any(r + 2 * h, a + h, a1n, b + h, b1n);
+
+	Limbs sums(2 * (h + 1));
+	Limb* sa = sums.data();
+	Limb* sb = square ? sa : sums.data() + h + 1;
+	sa[h] = add(sa, a, h, a + h, a1n);
+	if (!square) {
+		sb[h] = add(sb, b, h, b + h, b1n);
+	}
+	Limbs middle(2 * h + 2);
+	std::size_t san = normalized_size(sa, h + 1);
+	std::size_t sbn = normalized_size(sb, h + 1);
+	multiply_any(middle.data(), sa, san, sb, sbn);
+	std::size_t mn = san + sbn;
+	sub_from(middle.data(), mn, r, normalized_size(r, 2 * h));
+	sub_from(middle.data(), mn, r + 2 * h, normalized_size(r + 2 * h, an + bn - 2 * h));
+	add_into(r + h, an + bn - h, middle.data(), normalized_size(middle.data(), mn));
+}
+
+/**
+ * \brief Signed number for the Toom-3 evaluation and interpolation
+ */
+struct Signed {
+	Limbs magnitude;
+	bool negative = false;
+
+	Signed() = default;
+	Signed(const Limb* limbs, std::size_t n): magnitude(limbs, limbs + normalized_size(limbs, n)) {}
+};
+
+Signed add(const Signed& x, const Signed& y, bool subtract = false) {
+	bool y_negative = y.negative != subtract && !y.magnitude.empty();
+	const Limbs& a = x.magnitude;
+	const Limbs& b = y.magnitude;
+	Signed result;
+	if (x.negative == y_negative) {
+		const Limbs& longer = a.size() >= b.size() ? a : b;
+		const Limbs& shorter = a.size() >= b.size() ? b : a;
+		result.magnitude.resize(longer.size() + 1);
+		result.magnitude.back() = big_limbs::add(result.magnitude.data(), longer.data(), longer.size(), shorter.data(), shorter.size());
+		result.negative = x.negative;
+	} else if (compare(a.data(), a.size(), b.data(), b.size()) >= 0) {
+		result.magnitude.resize(a.size());
+		sub(result.magnitude.data(), a.data(), a.size(), b.data(), b.size());
+		result.negative = x.negative;
+	} else {
+		result.magnitude.resize(b.size());
+		sub(result.magnitude.data(), b.data(), b.size(), a.data(), a.size());
+		result.negative = y_negative;
+	}
+	normalize(result.magnitude);
+	result.negative = result.negative && !result.magnitude.empty();
+	return result;
+}
+
+Signed subtract(const Signed& x, const Signed& y) {
+	return add(x, y, true);
+}
+
+Signed product(const Signed& x, const Signed& y) {
+	Signed result;
+	result.magnitude.resize(x.magnitude.size() + y.magnitude.size());
+	multiply_any(result.magnitude.data(), x.magnitude.data(), x.magnitude.size(), y.magnitude.data(), y.magnitude.size());
+	normalize(result.magnitude);
+	result.negative = x.negative != y.negative && !result.magnitude.empty();
+	return result;
+}
+
+Signed times(Signed x, Limb factor) {
+	Limb high = mul_1(x.magnitude.data(), x.magnitude.data(), x.magnitude.size(), factor);
+	if (high) {
+		x.magnitude.push_back(high);
+	}
+	return x;
+}
+
+/**
+ * \brief x / divisor, the remainder must be 0
+ */
+Signed exact_quotient(Signed x, Limb divisor) {
+	divmod_1(x.magnitude.data(), x.magnitude.size(), divisor);
+	normalize(x.magnitude);
+	return x;
+}
+
+/**
+ * \brief a = a0 + a1 X + a2 X^2 (same for b): evaluates at 0, 1, -1, -2, infinity, multiplies the values
+ * (five third size products instead of nine) and interpolates the product with Bodrato's sequence
+ */
+void toom3(Limb* r, const Limb* a, std::size_t an, const Limb* b, std::size_t bn) {
+	if (an >= 2 * bn) {
+		unbalanced(r, a, an, b, bn);
+		return;
+	}
+	const bool square = a == b && an == bn;
+	const std::size_t k = (an + 2) / 3;
+	auto part = [k](const Limb* limbs, std::size_t n, std::size_t i) {
+		std::size_t from = std::min(n, i * k);
+		std::size_t to = std::min(n, from + k);
+		return Signed{limbs + from, to - from};
+	};
+
+	struct Values {
+		Signed at0, at1, at_minus1, at_minus2, at_infinity;
+	};
+	auto evaluate = [&](const Limb* limbs, std::size_t n) {
+		Signed m0 = part(limbs, n, 0), m1 = part(limbs, n, 1), m2 = part(limbs, n, 2);
+		Signed p0 = add(m0, m2);
+		Values values;
+		values.at0 = m0;
+		values.at1 = add(p0, m1);
+		values.at_minus1 = subtract(p0, m1);
+		values.at_minus2 = subtract(times(add(values.at_minus1, m2), 2), m0);
+		values.at_infinity = m2;
+		return values;
+	};
+	Values x = evaluate(a, an);
+	Values y_values;
+	if (!square) {
+		y_values = evaluate(b, bn);
+	}
+	const Values& y = square ? x : y_values; // same objects: the products are squares
+
+	Signed r0 = product(x.at0, y.at0);
+	Signed r1 = product(x.at1, y.at1);
+	Signed r_minus1 = product(x.at_minus1, y.at_minus1);
+	Signed r_minus2 = product(x.at_minus2, y.at_minus2);
+	Signed r4 = product(x.at_infinity, y.at_infinity);
+
+	Signed r3 = exact_quotient(subtract(r_minus2, r1), 3);
+	r1 = exact_quotient(subtract(r1, r_minus1), 2);
+	Signed r2 = subtract(r_minus1, r0);
+	r3 = add(exact_quotient(subtract(r2, r3), 2), times(r4, 2));
+	r2 = subtract(add(r2, r1), r4);
+	r1 = subtract(r1, r3);
+
+	std::fill(r, r + an + bn, 0);
+	const Signed* coefficients[] = {&r0, &r1, &r2, &r3, &r4};
+	for (std::size_t i = 0; i < 5; i++) {
+		const Limbs& coefficient = coefficients[i]->magnitude;
+		if (!coefficient.empty()) {
+			add_into(r + i * k, an + bn - i * k, coefficient.data(), coefficient.size());
+		}
+	}
+}
+
+/**
+ * \brief Number theoretic transform modulo the prime p = 2^64 - 2^32 + 1
+ *
+ * p - 1 is divisible by 2^32, so there are roots of unity for transforms up to 2^32 points. The limbs are split
+ * into 16-bit digits: a coefficient of the product is a sum of at most 2^30 products below 2^32, less than p.
+ */
+namespace ntt {
+
+constexpr Limb modulus = 0xFFFFFFFF00000001ULL;
+constexpr Limb epsilon = 0xFFFFFFFFULL;	/**< 2^64 mod p */
+constexpr Limb generator = 7;
+
+/**
+ * \brief x mod p using 2^64 = 2^32 - 1 and 2^96 = -1 (mod p)
+ */
+inline Limb reduce(Wide x) {
+	Limb low = static_cast<Limb>(x);
+	Limb high = static_cast<Limb>(x >> 64);
+	Limb high_high = high >> 32;
+	Limb high_low = high & epsilon;
+	// branch free: the conditions depend on random data, mispredictions would cost more than the arithmetic
+	Limb t0 = low - high_high;
+	t0 -= epsilon & (0 - static_cast<Limb>(low < high_high));
+	Limb t1 = high_low * epsilon;
+	Limb result = t0 + t1;
+	result += epsilon & (0 - static_cast<Limb>(result < t1));
+	return result - (modulus & (0 - static_cast<Limb>(result >= modulus)));
+}
+
+inline Limb mul_mod(Limb a, Limb b) {
+	return reduce(Wide{a} * b);
+}
+
+inline Limb add_mod(Limb a, Limb b) {
+	Limb sum = a + b;
+	sum += epsilon & (0 - static_cast<Limb>(sum < a));
+	return sum - (modulus & (0 - static_cast<Limb>(sum >= modulus)));
+}
+
+inline Limb sub_mod(Limb a, Limb b) {
+	Limb difference = a - b;
+	return difference - (epsilon & (0 - static_cast<Limb>(a < b)));
+}
+
+Limb pow_mod(Limb base, Limb exponent) {
+	Limb result = 1;
+	for (; exponent; exponent >>= 1) {
+		if (exponent & 1) {
+			result = mul_mod(result, base);
+		}
+		base = mul_mod(base, base);
+	}
+	return result;
+}
+
+/**
+ * \brief Twiddle factors of all levels, contiguous per level: for a butterfly span of 2h points
+ * the powers 0 .. h - 1 of a primitive 2h-th root of unity (or of its inverse) are at [h, 2h)
+ */
+Limbs twiddles(std::size_t n, bool inverse) {
+	Limbs table(n);
+	for (std::size_t half = 1; half < n; half *= 2) {
+		Limb root = pow_mod(generator, (modulus - 1) / (2 * half));
+		if (inverse) {
+			root = pow_mod(root, modulus - 2);
+		}
+		Limb power = 1;
+		for (std::size_t j = 0; j < half; j++) {
+			table[half + j] = power;
+			power = mul_mod(power, root);
+		}
+	}
+	return table;
+}
+
+/**
+ * \brief Decimation in frequency, the output is in bit reversed order
+ */
+void forward(Limbs& values, const Limbs& twiddles) {
+	const std::size_t n = values.size();
+	for (std::size_t half = n / 2; half >= 1; half /= 2) {
+		const Limb* roots = twiddles.data() + half;
+		for (std::size_t start = 0; start < n; start += 2 * half) {
+			Limb* low = values.data() + start;
+			Limb* high = low + half;
+			for (std::size_t j = 0; j < half; j++) {
+				Limb u = low[j];
+				Limb v = high[j];
+				low[j] = add_mod(u, v);
+				high[j] = mul_mod(sub_mod(u, v), roots[j]);
+			}
+		}
+	}
+}
+
+/**
+ * \brief Decimation in time from bit reversed order with the inverse twiddles, not scaled by 1/n
+ */
+void inverse(Limbs& values, const Limbs& twiddles) {
+	const std::size_t n = values.size();
+	for (std::size_t half = 1; half < n; half *= 2) {
+		const Limb* roots = twiddles.data() + half;
+		for (std::size_t start = 0; start < n; start += 2 * half) {
+			Limb* low = values.data() + start;
+			Limb* high = low + half;
+			for (std::size_t j = 0; j < half; j++) {
+				Limb u = low[j];
+				Limb v = mul_mod(high[j], roots[j]);
+				low[j] = add_mod(u, v);
+				high[j] = sub_mod(u, v);
+			}
+		}
+	}
+}
+
+constexpr int digit_bits = 16;
+constexpr int digits_per_limb = 64 / digit_bits;
+
+void split_digits(Limbs& digits, const Limb* limbs, std::size_t n) {
+	for (std::size_t i = 0; i < n; i++) {
+		for (int j = 0; j < digits_per_limb; j++) {
+			digits[i * digits_per_limb + j] = (limbs[i] >> (j * digit_bits)) & 0xFFFF;
+		}
+	}
+}
+
+void multiply(Limb* r, const Limb* a, std::size_t an, const Limb* b, std::size_t bn) {
+	const bool square = a == b && an == bn;
+	std::size_t digit_count = (an + bn) * digits_per_limb;
+	std::size_t n = 2;
+	while (n < digit_count) {
+		n *= 2;
+	}
+	if (n > (std::size_t{1} << 32)) {
+		throw std::length_error("operands too long for the NTT");
+	}
+	Limbs forward_twiddles = twiddles(n, false);
+	Limbs x(n);
+	split_digits(x, a, an);
+	forward(x, forward_twiddles);
+	const Limb scale = pow_mod(n, modulus - 2); // 1/n of the inverse transform, applied to the products
+	if (square) {
+		for (Limb& value: x) {
+			value = mul_mod(mul_mod(value, value), scale);
+		}
+	} else {
+		Limbs y(n);
+		split_digits(y, b, bn);
+		forward(y, forward_twiddles);
+		for (std::size_t i = 0; i < n; i++) {
+			x[i] = mul_mod(mul_mod(x[i], y[i]), scale);
+		}
+	}
+	inverse(x, twiddles(n, true));
+
+	Wide carry = 0;
+	for (std::size_t i = 0; i < an + bn; i++) {
+		Limb limb = 0;
+		for (int j = 0; j < digits_per_limb; j++) {
+			carry += x[i * digits_per_limb + j];
+			limb |= static_cast<Limb>(carry & 0xFFFF) << (j * digit_bits);
+			carry >>= digit_bits;
+		}
+		r[i] = limb;
+	}
+}
+
+}
+
+void multiply(Limb* r, const Limb* a, std::size_t an, const Limb* b, std::size_t bn, Algorithm algorithm) {
+	if (algorithm == Algorithm::automatic) {
+		const Thresholds& limits = thresholds();
+		if (bn < limits.karatsuba) {
+			algorithm = Algorithm::schoolbook;
+		} else if (bn >= limits.ntt) {
+			algorithm = Algorithm::ntt;
+		} else if (an >= 2 * bn) {
+			unbalanced(r, a, an, b, bn);
+			return;
+		} else {
+			algorithm = bn < limits.toom3 ? Algorithm::karatsuba : Algorithm::toom3;
+		}
+	}
+	switch (algorithm) {
+	case Algorithm::karatsuba:
+		karatsuba(r, a, an, b, bn);
+		break;
+	case Algorithm::toom3:
+		toom3(r, a, an, b, bn);
+		break;
+	case Algorithm::ntt:
+		ntt::multiply(r, a, an, b, bn);
+		break;
+	default:
+		schoolbook(r, a, an, b, bn);
+	}
+}
+
+/**
+ * \brief Seconds per call of a * b with algorithm at the top level, best of three batches of at least a millisecond
+ */
+double seconds_per_multiplication(const BigUnsigned& a, const BigUnsigned& b, Algorithm algorithm) {
+	using clock = std::chrono::steady_clock;
+	double best = 0;
+	for (int batch = 0; batch < 3; batch++) {
+		long calls = 0;
+		auto begin = clock::now();
+		std::chrono::duration<double> elapsed{0};
+		do {
+			BigUnsigned product = big_multiplication::multiply(a, b, algorithm);
+			calls++;
+			elapsed = clock::now() - begin;
+		} while (elapsed.count() < 1e-3);
+		double seconds = elapsed.count() / calls;
+		best = batch == 0 ? seconds : std::min(best, seconds);
+	}
+	return best;
+}
+
+}
+
+const char* name(Algorithm algorithm) {
+	switch (algorithm) {
+	case Algorithm::schoolbook: return "schoolbook";
+	case Algorithm::karatsuba: return "karatsuba";
+	case Algorithm::toom3: return "toom3";
+	case Algorithm::ntt: return "ntt";
+	default: return "automatic";
+	}
+}
+
+Thresholds& thresholds() {
+	static Thresholds thresholds;
+	return thresholds;
+}
+
+BigUnsigned multiply(const BigUnsigned& a, const BigUnsigned& b, Algorithm algorithm) {
+	const Limbs& x = a.get_limbs().size() >= b.get_limbs().size() ? a.get_limbs() : b.get_limbs();
+	const Limbs& y = a.get_limbs().size() >= b.get_limbs().size() ? b.get_limbs() : a.get_limbs();
+	if (y.empty()) {
+		return BigUnsigned{};
+	}
+	Limbs result(x.size() + y.size());
+	multiply(result.data(), x.data(), x.size(), y.data(), y.size(), algorithm);
+	return BigUnsigned::from_limbs(std::move(result));
+}
+
+Thresholds tune(std::ostream* log) {
+	std::mt19937_64 random{20201018};
+	auto random_number = [&random](std::size_t limbs) {
+		Limbs values(limbs);
+		for (Limb& value: values) {
+			value = random();
+		}
+		values.back() |= 1ULL << 63;
+		return BigUnsigned::from_limbs(std::move(values));
+	};
+
+	// the first of two sizes in a row where faster wins, the threshold of faster is the measured size
+	// while measuring, so its recursion goes down to the previous algorithm at once
+	auto crossover = [&](Algorithm slower, Algorithm faster, std::size_t& threshold, std::size_t from, std::size_t to) {
+		std::size_t first_win = 0;
+		for (std::size_t n = from; n <= to; n += std::max<std::size_t>(1, n / 8)) {
+			threshold = n;
+			BigUnsigned a = random_number(n);
+			BigUnsigned b = random_number(n);
+			double slower_seconds = seconds_per_multiplication(a, b, slower);
+			double faster_seconds = seconds_per_multiplication(a, b, faster);
+			if (log) {
+				*log<<n<<" limbs\t"<<name(slower)<<" "<<slower_seconds * 1e6<<" us\t"<<name(faster)<<" "<<faster_seconds * 1e6<<" us"<<std::endl;
+			}
+			if (faster_seconds >= slower_seconds) {
+				first_win = 0;
+			} else if (first_win) {
+				threshold = first_win;
+				return;
+			} else {
+				first_win = n;
+			}
+		}
+		threshold = to;
+	};
+
+	Thresholds& current = thresholds();
+	current = Thresholds{};
+	current.toom3 = current.ntt = SIZE_MAX;
+	crossover(Algorithm::schoolbook, Algorithm::karatsuba, current.karatsuba, 8, 256);
+	crossover(Algorithm::karatsuba, Algorithm::toom3, current.toom3, current.karatsuba * 3, 2048);
+	crossover(Algorithm::toom3, Algorithm::ntt, current.ntt, current.toom3, 65536);
+	return current;
+}
+
+}
+
+BigUnsigned operator*(const BigUnsigned& a, const BigUnsigned& b) {
+	return big_multiplication::multiply(a, b);
+}
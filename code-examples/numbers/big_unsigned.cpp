@@ -0,0 +1,202 @@
+/*
+ * big_unsigned.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "big_unsigned.h"
+#include "big_limbs.h"
+#include "primes.h"
+
+#include <algorithm>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+
+using namespace big_limbs;
+
+void BigUnsigned::normalize() {
+	big_limbs::normalize(limbs);
+}
+
+BigUnsigned::BigUnsigned(std::uint64_t value) {
+	if (value) {
+		limbs.push_back(value);
+	}
+}
+
+BigUnsigned BigUnsigned::from_limbs(std::vector<Limb> limbs) {
+	BigUnsigned result;
+	result.limbs = std::move(limbs);
+	result.normalize();
+	return result;
+}
+
+std::size_t BigUnsigned::bit_length() const {
+	if (limbs.empty()) {
+		return 0;
+	}
+	return limbs.size() * 64 - static_cast<std::size_t>(__builtin_clzll(limbs.back()));
+}
+
+std::uint64_t BigUnsigned::to_uint64() const {
+	if (limbs.size() > 1) {
+		throw std::overflow_error("BigUnsigned doesn't fit into 64 bits");
+	}
+	return limbs.empty() ? 0 : limbs[0];
+}
+
+BigUnsigned& BigUnsigned::operator+=(const BigUnsigned& b) {
+	if (limbs.size() < b.limbs.size()) {
+		limbs.resize(b.limbs.size());
+	}
+	Limb carry = add(limbs.data(), limbs.data(), limbs.size(), b.limbs.data(), b.limbs.size());
+	if (carry) {
+		limbs.push_back(carry);
+	}
+	return *this;
+}
+
+BigUnsigned& BigUnsigned::operator-=(const BigUnsigned& b) {
+	if (*this < b) {
+		throw std::underflow_error("BigUnsigned subtraction result is negative");
+	}
+	sub(limbs.data(), limbs.data(), limbs.size(), b.limbs.data(), b.limbs.size());
+	normalize();
+	return *this;
+}
+
+BigUnsigned& BigUnsigned::operator*=(std::uint64_t b) {
+	Limb high = mul_1(limbs.data(), limbs.data(), limbs.size(), b);
+	if (high) {
+		limbs.push_back(high);
+	}
+	normalize();
+	return *this;
+}
+
+BigUnsigned& BigUnsigned::operator<<=(std::size_t bits) {
+	if (limbs.empty()) {
+		return *this;
+	}
+	std::size_t shift = bits % 64;
+	limbs.insert(limbs.begin(), bits / 64, 0);
+	if (shift) {
+		Limb carry = 0;
+		for (std::size_t i = bits / 64; i < limbs.size(); i++) {
+			Limb limb = limbs[i];
+			limbs[i] = limb << shift | carry;
+			carry = limb >> (64 - shift);
+		}
+		if (carry) {
+			limbs.push_back(carry);
+		}
+	}
+	return *this;
+}
+
+BigUnsigned& BigUnsigned::operator>>=(std::size_t bits) {
+	if (bits / 64 >= limbs.size()) {
+		limbs.clear();
+		return *this;
+	}
+	limbs.erase(limbs.begin(), limbs.begin() + static_cast<std::ptrdiff_t>(bits / 64));
+	std::size_t shift = bits % 64;
+	if (shift) {
+		for (std::size_t i = 0; i < limbs.size(); i++) {
+			Limb high = i + 1 < limbs.size() ? limbs[i + 1] << (64 - shift) : 0;
+			limbs[i] = limbs[i] >> shift | high;
+		}
+	}
+	normalize();
+	return *this;
+}
+
+std::uint64_t BigUnsigned::divide(std::uint64_t divisor) {
+	if (divisor == 0) {
+		throw std::invalid_argument("division by zero");
+	}
+	Limb remainder = divmod_1(limbs.data(), limbs.size(), divisor);
+	normalize();
+	return remainder;
+}
+
+bool operator<(const BigUnsigned& a, const BigUnsigned& b) {
+	return compare(a.limbs.data(), a.limbs.size(), b.limbs.data(), b.limbs.size()) < 0;
+}
+
+std::ostream& operator<<(std::ostream& out, const BigUnsigned& value) {
+	return out<<value.to_string();
+}
+
+namespace {
+
+/**
+ * \brief Product of numbers[from, to), in a tree of balanced multiplications
+ */
+BigUnsigned product_tree(const std::vector<std::uint64_t>& numbers, std::size_t from, std::size_t to) {
+	if (to - from == 1) {
+		return numbers[from];
+	}
+	std::size_t middle = from + (to - from) / 2;
+	return product_tree(numbers, from, middle) * product_tree(numbers, middle, to);
+}
+
+}
+
+BigUnsigned BigUnsigned::product(const std::vector<std::uint64_t>& numbers) {
+	// words as full as possible first, the tree then multiplies numbers of similar sizes
+	std::vector<std::uint64_t> words;
+	Wide word = 1;
+	for (std::uint64_t number: numbers) {
+		if (number == 0) {
+			return BigUnsigned{};
+		}
+		Wide next = word * number;
+		if (next >> 64) {
+			words.push_back(static_cast<std::uint64_t>(word));
+			next = number;
+		}
+		word = next;
+	}
+	words.push_back(static_cast<std::uint64_t>(word));
+	return product_tree(words, 0, words.size());
+}
+
+BigUnsigned BigUnsigned::factorial(unsigned n) {
+	if (n <= 20) {
+		std::uint64_t result = 1;
+		for (unsigned i = 2; i <= n; i++) {
+			result *= i;
+		}
+		return result;
+	}
+	std::vector<std::uint64_t> prime_list = primes::between(2, n);
+	std::vector<unsigned> exponents;
+	for (std::uint64_t prime: prime_list) {
+		unsigned exponent = 0;
+		for (unsigned multiples = n; multiples >= prime;) {
+			multiples /= static_cast<unsigned>(prime);
+			exponent += multiples;
+		}
+		exponents.push_back(exponent);
+	}
+	// 2 has the largest exponent
+	int top_bit = 31 - __builtin_clz(exponents[0]);
+	BigUnsigned result{1};
+	std::vector<std::uint64_t> factors;
+	for (int bit = top_bit; bit >= 0; bit--) {
+		factors.clear();
+		for (std::size_t i = 0; i < prime_list.size() && exponents[i] >= (1u << bit); i++) {
+			if (exponents[i] >> bit & 1) {
+				factors.push_back(prime_list[i]);
+			}
+		}
+		result = result * result;
+		if (!factors.empty()) {
+			result = result * product(factors);
+		}
+	}
+	return result;
+}
@@ -0,0 +1,189 @@
+/*
+ * big_unsigned.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_NUMBERS_BIG_UNSIGNED_H_
+#define CODE_EXAMPLES_NUMBERS_BIG_UNSIGNED_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Non-negative integer of any size: little endian 64-bit limbs without leading zeros (zero has none)
+ *
+ * Multiplication picks schoolbook, Karatsuba, Toom-3 or NTT by the operand sizes, see big_multiplication.
+ * Decimal conversion splits the number by powers 10^(19 * 2^k) (big_decimal.cpp), so it costs a few
+ * multiplications of the full size instead of a division by 10^19 per 19 digits.
+ */
+class BigUnsigned {
+public:
+	using Limb = std::uint64_t;
+private:
+	std::vector<Limb> limbs;
+
+	void normalize();
+public:
+	BigUnsigned() = default;
+	BigUnsigned(std::uint64_t value);
+
+	/**
+	 * \brief Number with the given limbs (little endian), leading zeros are removed
+	 */
+	static BigUnsigned from_limbs(std::vector<Limb> limbs);
+
+	const std::vector<Limb>& get_limbs() const {
+		return limbs;
+	}
+
+	bool is_zero() const {
+		return limbs.empty();
+	}
+
+	std::size_t bit_length() const;
+
+	/**
+	 * \throw std::overflow_error if the value doesn't fit
+	 */
+	std::uint64_t to_uint64() const;
+
+	/**
+	 * \brief Decimal digits
+	 */
+	std::string to_string() const;
+
+	/**
+	 * \brief Value of decimal digits, leading zeros are allowed
+	 * \throw std::invalid_argument if digits is empty or has other characters
+	 */
+	static BigUnsigned from_string(const std::string& digits);
+
+	BigUnsigned& operator+=(const BigUnsigned& b);
+
+	/**
+	 * \throw std::underflow_error if b is greater
+	 */
+	BigUnsigned& operator-=(const BigUnsigned& b);
+
+	BigUnsigned& operator*=(std::uint64_t b);
+
+	BigUnsigned& operator<<=(std::size_t bits);
+
+	BigUnsigned& operator>>=(std::size_t bits);
+
+	/**
+	 * \brief Divides by divisor in place
+	 * \return the remainder
+	 * \throw std::invalid_argument if divisor is 0
+	 */
+	std::uint64_t divide(std::uint64_t divisor);
+
+	friend BigUnsigned operator+(BigUnsigned a, const BigUnsigned& b) {
+		return a += b;
+	}
+
+	friend BigUnsigned operator-(BigUnsigned a, const BigUnsigned& b) {
+		return a -= b;
+	}
+
+	friend BigUnsigned operator*(const BigUnsigned& a, const BigUnsigned& b);
+
+	friend BigUnsigned operator<<(BigUnsigned a, std::size_t bits) {
+		return a <<= bits;
+	}
+
+	friend BigUnsigned operator>>(BigUnsigned a, std::size_t bits) {
+		return a >>= bits;
+	}
+
+	friend bool operator==(const BigUnsigned& a, const BigUnsigned& b) {
+		return a.limbs == b.limbs;
+	}
+
+	friend bool operator!=(const BigUnsigned& a, const BigUnsigned& b) {
+		return !(a == b);
+	}
+
+	friend bool operator<(const BigUnsigned& a, const BigUnsigned& b);
+
+	friend bool operator>(const BigUnsigned& a, const BigUnsigned& b) {
+		return b < a;
+	}
+
+	friend bool operator<=(const BigUnsigned& a, const BigUnsigned& b) {
+		return !(b < a);
+	}
+
+	friend bool operator>=(const BigUnsigned& a, const BigUnsigned& b) {
+		return !(a < b);
+	}
+
+	friend std::ostream& operator<<(std::ostream& out, const BigUnsigned& value);
+
+	/**
+	 * \brief n! as the product of prime powers p^e (Legendre's formula): for every bit of the exponents,
+	 * from the highest, the result is squared and multiplied by the primes with that bit set
+	 *
+	 * The big multiplications are squarings and products of similar sizes, where the fast algorithms pay off;
+	 * multiplying by 2, 3, ..., n one after another is quadratic.
+	 * The int factorial() of the doctest lab (lab_k29_15_09_2020_doctest.cpp) stays as it is, it is the lab's
+	 * example of a tested function and only has to be right up to 12!.
+	 */
+	static BigUnsigned factorial(unsigned n);
+
+	/**
+	 * \brief Product of the numbers, multiplied in a balanced tree
+	 */
+	static BigUnsigned product(const std::vector<std::uint64_t>& numbers);
+};
+
+/**
+ * \brief Multiplication algorithms and the operand sizes at which they take over
+ */
+namespace big_multiplication {
+
+enum class Algorithm { automatic, schoolbook, karatsuba, toom3, ntt };
+
+const char* name(Algorithm algorithm);
+
+/**
+ * \brief Sizes in limbs of the smaller operand from which an algorithm is used
+ *
+ * Operands more than twice as long as the other one are split into pieces of the shorter length first
+ * (below the NTT threshold, NTT doesn't need it).
+ */
+struct Thresholds {
+	std::size_t karatsuba = 32;
+	std::size_t toom3 = 440;
+	std::size_t ntt = 13000;
+};
+
+/**
+ * \brief Thresholds used by operator*, defaults measured with tune() on x86-64 (bench_bigint --tune prints them)
+ *
+ * Change them before multiplying in several threads.
+ */
+Thresholds& thresholds();
+
+/**
+ * \brief a * b with the given algorithm at the top level, smaller products use automatic
+ */
+BigUnsigned multiply(const BigUnsigned& a, const BigUnsigned& b, Algorithm algorithm = Algorithm::automatic);
+
+/**
+ * \brief Measures the crossover sizes on this machine (about a second), sets and returns them
+ *
+ * Each algorithm is compared with the previous one on random balanced operands, one level of it
+ * with the rest of the recursion below its threshold.
+ * \param log progress (times per size), may be nullptr
+ */
+Thresholds tune(std::ostream* log = nullptr);
+
+}
+
+#endif /* CODE_EXAMPLES_NUMBERS_BIG_UNSIGNED_H_ */
@@ -0,0 +1,155 @@
+/*
+ * big_unsigned_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "big_unsigned.h"
+#include "../commands.h"
+
+#ifdef GMP_ENABLED
+#include <gmp.h>
+#endif
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace bench_bigint {
+
+using big_multiplication::Algorithm;
+
+/**
+ * \brief Seconds per call, repeated for at least 10 ms
+ */
+template<typename Function>
+double seconds_per_call(Function function) {
+	long calls = 0;
+	auto begin = std::chrono::steady_clock::now();
+	std::chrono::duration<double> elapsed{0};
+	do {
+		function();
+		calls++;
+		elapsed = std::chrono::steady_clock::now() - begin;
+	} while (elapsed.count() < 0.01);
+	return elapsed.count() / calls;
+}
+
+BigUnsigned random_number(std::mt19937_64& random, std::size_t limbs) {
+	std::vector<std::uint64_t> values(limbs);
+	for (std::uint64_t& value: values) {
+		value = random();
+	}
+	values.back() |= 1ULL << 63;
+	return BigUnsigned::from_limbs(values);
+}
+
+#ifdef GMP_ENABLED
+/**
+ * \brief Owns an mpz_t with the value of a BigUnsigned
+ */
+class GmpNumber {
+public:
+	mpz_t value;
+
+	GmpNumber() {
+		mpz_init(value);
+	}
+	explicit GmpNumber(const BigUnsigned& number): GmpNumber() {
+		const auto& limbs = number.get_limbs();
+		mpz_import(value, limbs.size(), -1, sizeof(std::uint64_t), 0, 0, limbs.data());
+	}
+	~GmpNumber() {
+		mpz_clear(value);
+	}
+	GmpNumber(const GmpNumber&) = delete;
+	GmpNumber& operator=(const GmpNumber&) = delete;
+
+	bool operator==(const BigUnsigned& number) const {
+		GmpNumber other{number};
+		return mpz_cmp(value, other.value) == 0;
+	}
+};
+#endif
+
+// usage: bench_bigint [max limbs] [max factorial n] [--tune]
+// times in microseconds, schoolbook stops at 8192 limbs
+int main(int argc, char** argv) {
+	std::size_t max_limbs = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 262144;
+	unsigned max_factorial = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : 1000000;
+	if (argc > 3 && std::string{argv[3]} == "--tune") {
+		big_multiplication::Thresholds tuned = big_multiplication::tune(&std::cout);
+		std::cout<<"tuned thresholds (limbs): karatsuba "<<tuned.karatsuba<<", toom3 "<<tuned.toom3<<", ntt "<<tuned.ntt<<std::endl;
+	}
+	const big_multiplication::Thresholds& thresholds = big_multiplication::thresholds();
+	std::cout<<"thresholds (limbs): karatsuba "<<thresholds.karatsuba<<", toom3 "<<thresholds.toom3<<", ntt "<<thresholds.ntt<<std::endl;
+
+	std::mt19937_64 random{96};
+	std::cout<<"limbs\tschoolbook\tkaratsuba\ttoom3\tntt\tautomatic";
+#ifdef GMP_ENABLED
+	std::cout<<"\tgmp";
+#endif
+	std::cout<<std::endl;
+	for (std::size_t limbs = 16; limbs <= max_limbs; limbs *= 4) {
+		BigUnsigned a = random_number(random, limbs);
+		BigUnsigned b = random_number(random, limbs);
+		std::cout<<limbs;
+		for (Algorithm algorithm: {Algorithm::schoolbook, Algorithm::karatsuba, Algorithm::toom3, Algorithm::ntt, Algorithm::automatic}) {
+			if (algorithm == Algorithm::schoolbook && limbs > 8192) {
+				std::cout<<"\t-";
+				continue;
+			}
+			std::cout<<"\t"<<seconds_per_call([&]() { return big_multiplication::multiply(a, b, algorithm); }) * 1e6;
+		}
+#ifdef GMP_ENABLED
+		GmpNumber x{a}, y{b}, product;
+		std::cout<<"\t"<<seconds_per_call([&]() { mpz_mul(product.value, x.value, y.value); }) * 1e6;
+		if (!(product == a * b)) {
+			std::cout<<"\tproducts differ from GMP"<<std::endl;
+			return 1;
+		}
+#endif
+		std::cout<<std::endl;
+	}
+
+	std::cout<<"n\tn! limbs\tsequential *=\tprime powers";
+#ifdef GMP_ENABLED
+	std::cout<<"\tgmp mpz_fac_ui";
+#endif
+	std::cout<<std::endl;
+	for (unsigned n = 1000; n <= max_factorial; n *= 10) {
+		BigUnsigned factorial = BigUnsigned::factorial(n);
+		std::cout<<n<<"\t"<<factorial.get_limbs().size()<<"\t";
+		if (n <= 100000) {
+			std::cout<<seconds_per_call([n]() {
+				BigUnsigned product{1};
+				for (unsigned i = 2; i <= n; i++) {
+					product *= i;
+				}
+				return product;
+			}) * 1e6;
+		} else {
+			std::cout<<"-";
+		}
+		std::cout<<"\t"<<seconds_per_call([n]() { return BigUnsigned::factorial(n); }) * 1e6;
+#ifdef GMP_ENABLED
+		GmpNumber gmp_factorial;
+		std::cout<<"\t"<<seconds_per_call([&]() { mpz_fac_ui(gmp_factorial.value, n); }) * 1e6;
+		if (!(gmp_factorial == factorial)) {
+			std::cout<<"\tfactorial differs from GMP"<<std::endl;
+			return 1;
+		}
+#endif
+		std::cout<<std::endl;
+	}
+	return 0;
+}
+
+static commands::Registrar registrar{"bench_bigint", commands::Kind::benchmark, main,
+		"BigUnsigned multiplication algorithms and factorial (GMP with -DGMP_ENABLED -lgmp)", {"4096", "10000"}};
+
+}
@@ -0,0 +1,156 @@
+/*
+ * big_unsigned_test.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "big_unsigned.h"
+
+#include "../doctest.h"
+
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace test_big_unsigned {
+
+BigUnsigned random_number(std::mt19937_64& random, std::size_t limbs) {
+	std::vector<std::uint64_t> values(limbs);
+	for (std::uint64_t& value: values) {
+		value = random();
+	}
+	return BigUnsigned::from_limbs(values);
+}
+
+BigUnsigned all_ones(std::size_t limbs) {
+	return BigUnsigned::from_limbs(std::vector<std::uint64_t>(limbs, UINT64_MAX));
+}
+
+}
+
+TEST_CASE("[big unsigned] - arithmetic with single limbs") {
+	BigUnsigned max{UINT64_MAX};
+	BigUnsigned sum = max + 1;
+	CHECK(sum.get_limbs() == std::vector<std::uint64_t>{0, 1});
+	CHECK(sum.bit_length() == 65);
+	CHECK(sum - 1 == max);
+	CHECK(sum.to_string() == "18446744073709551616");
+	CHECK(BigUnsigned{}.to_string() == "0");
+	CHECK(BigUnsigned{}.is_zero());
+	CHECK(BigUnsigned::from_limbs({5, 0, 0}).get_limbs().size() == 1);
+
+	BigUnsigned product = max;
+	product *= UINT64_MAX;
+	CHECK(product.to_string() == "340282366920938463426481119284349108225");
+	CHECK(product.divide(UINT64_MAX) == 0);
+	CHECK(product == max);
+	CHECK(product.divide(10) == 5);
+	CHECK(product.to_uint64() == UINT64_MAX / 10);
+
+	CHECK(BigUnsigned{3} < sum);
+	CHECK(sum > max);
+	CHECK(max <= max);
+	CHECK_THROWS_AS(BigUnsigned{3} - sum, std::underflow_error);
+	CHECK_THROWS_AS(sum.to_uint64(), std::overflow_error);
+	CHECK_THROWS_AS(sum.divide(0), std::invalid_argument);
+
+	std::ostringstream out;
+	out<<BigUnsigned{1234567};
+	CHECK(out.str() == "1234567");
+}
+
+TEST_CASE("[big unsigned] - borrows across zero limbs") {
+	// the result is written over the first operand, the borrow must be taken from the limb before it is overwritten
+	BigUnsigned power = BigUnsigned::from_limbs({0, 0, 1});
+	CHECK(power - 1 == test_big_unsigned::all_ones(2));
+	CHECK((power - 1).to_string() == "340282366920938463463374607431768211455");
+
+	BigUnsigned value = BigUnsigned::from_limbs({0, 0, 0, 0, 7});
+	value -= 1;
+	CHECK(value.get_limbs() == std::vector<std::uint64_t>{UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX, 6});
+	value -= BigUnsigned::from_limbs({UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX, 6});
+	CHECK(value.is_zero());
+
+	value = BigUnsigned::from_limbs({0, 0, 0, 1});
+	value -= BigUnsigned::from_limbs({1, 1});
+	CHECK(value.get_limbs() == std::vector<std::uint64_t>{UINT64_MAX, UINT64_MAX - 1, UINT64_MAX});
+}
+
+TEST_CASE("[big unsigned] - multiplication algorithms agree with schoolbook") {
+	using big_multiplication::Algorithm;
+	std::mt19937_64 random{96};
+	for (std::size_t limbs: {1, 2, 3, 7, 31, 64, 65, 200, 513}) {
+		for (std::size_t other: {limbs, limbs / 2 + 1, limbs * 3 + 1}) {
+			CAPTURE(limbs);
+			CAPTURE(other);
+			BigUnsigned a = test_big_unsigned::random_number(random, limbs);
+			BigUnsigned b = test_big_unsigned::random_number(random, other);
+			BigUnsigned expected = big_multiplication::multiply(a, b, Algorithm::schoolbook);
+			CHECK(expected.get_limbs().size() >= limbs + other - 1);
+			for (Algorithm algorithm: {Algorithm::karatsuba, Algorithm::toom3, Algorithm::ntt, Algorithm::automatic}) {
+				CAPTURE(big_multiplication::name(algorithm));
+				CHECK(big_multiplication::multiply(a, b, algorithm) == expected);
+				CHECK(big_multiplication::multiply(b, a, algorithm) == expected);
+			}
+		}
+	}
+
+	SUBCASE("carries and squares") {
+		for (std::size_t limbs: {1, 40, 300, 2500}) {
+			CAPTURE(limbs);
+			BigUnsigned ones = test_big_unsigned::all_ones(limbs);
+			// (2^k - 1)^2 = 2^2k - 2^(k+1) + 1
+			std::vector<std::uint64_t> expected(2 * limbs, 0);
+			expected[0] = 1;
+			for (std::size_t i = limbs; i < 2 * limbs; i++) {
+				expected[i] = UINT64_MAX;
+			}
+			expected[limbs] = UINT64_MAX - 1;
+			for (Algorithm algorithm: {Algorithm::schoolbook, Algorithm::karatsuba, Algorithm::toom3, Algorithm::ntt, Algorithm::automatic}) {
+				CAPTURE(big_multiplication::name(algorithm));
+				CHECK(big_multiplication::multiply(ones, ones, algorithm).get_limbs() == expected);
+			}
+		}
+	}
+
+	SUBCASE("zero") {
+		BigUnsigned a = test_big_unsigned::random_number(random, 100);
+		CHECK((a * BigUnsigned{}).is_zero());
+		CHECK((BigUnsigned{} * a).is_zero());
+	}
+}
+
+TEST_CASE("[big unsigned] - large operands with thresholds") {
+	std::mt19937_64 random{2020};
+	BigUnsigned a = test_big_unsigned::random_number(random, 6000);
+	BigUnsigned b = test_big_unsigned::random_number(random, 4000);
+	BigUnsigned expected = big_multiplication::multiply(a, b, big_multiplication::Algorithm::schoolbook);
+	CHECK(a * b == expected);
+
+	big_multiplication::Thresholds saved = big_multiplication::thresholds();
+	big_multiplication::thresholds() = big_multiplication::Thresholds{4, 12, 400}; // deep recursion of every kind
+	CHECK(a * b == expected);
+	CHECK(a * a == big_multiplication::multiply(a, a, big_multiplication::Algorithm::schoolbook));
+	big_multiplication::thresholds() = saved;
+}
+
+TEST_CASE("[big unsigned] - factorial") {
+	CHECK(BigUnsigned::factorial(0) == 1);
+	CHECK(BigUnsigned::factorial(20).to_uint64() == 2432902008176640000ULL);
+	CHECK(BigUnsigned::factorial(25).to_string() == "15511210043330985984000000");
+	CHECK(BigUnsigned::factorial(100).to_string().size() == 158);
+
+	for (unsigned n: {21u, 64u, 1000u, 5000u}) {
+		CAPTURE(n);
+		BigUnsigned sequential{1};
+		for (unsigned i = 2; i <= n; i++) {
+			sequential *= i;
+		}
+		CHECK(BigUnsigned::factorial(n) == sequential);
+	}
+	CHECK(BigUnsigned::product({}) == 1);
+	CHECK(BigUnsigned::product({UINT64_MAX, UINT64_MAX, 0}).is_zero());
+}
@@ -0,0 +1,357 @@
+/*
+ * combinatorics.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "combinatorics.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+namespace combinatorics {
+
+namespace {
+
+/**
+ * \brief Advances a row of a triangle in place: values holds row n - 1 and becomes row n
+ *
+ * Column k of row n needs columns k and k - 1 of row n - 1, so columns are updated from the right.
+ */
+template<typename Arithmetic>
+class Sweep {
+private:
+	using Value = typename Arithmetic::Value;
+	using Multiplier = typename Arithmetic::Multiplier;
+
+	static constexpr std::size_t block = 8;
+
+	Triangle triangle;
+	const Arithmetic& arithmetic;
+	Value* values;
+	std::vector<Multiplier> column_multipliers;	/**< k for stirling2 */
+public:
+	/**
+	 * \param values room for the last row, zeros after the first one
+	 */
+	Sweep(Triangle triangle, const Arithmetic& arithmetic, Value* values, std::size_t last_row):
+			triangle{triangle}, arithmetic{arithmetic}, values{values} {
+		if (triangle == Triangle::stirling2) {
+			for (std::size_t k = 0; k <= last_row; k++) {
+				column_multipliers.push_back(arithmetic.multiplier(k));
+			}
+		}
+	}
+
+	/**
+	 * \brief v[k] = update(v[k], v[k - 1], k) for k = high, high - 1, ..., low
+	 *
+	 * In blocks of 8 columns from the right, each block reads all its old values before it writes:
+	 * the loops over a block run forwards and have a constant trip count, which -O2 vectorizes.
+	 */
+	template<typename Update>
+	static void descending(Value* v, std::size_t low, std::size_t high, Update update) {
+		std::size_t end = high + 1;
+		for (; end >= low + block; end -= block) {
+			Value* first = v + end - block;
+			Value updated[block];
+			for (std::size_t i = 0; i < block; i++) {
+				updated[i] = update(first[i], first[i - 1], end - block + i);
+			}
+			for (std::size_t i = 0; i < block; i++) {
+				first[i] = std::move(updated[i]);
+			}
+		}
+		for (std::size_t k = end; k-- > low;) {
+			v[k] = update(v[k], v[k - 1], k);
+		}
+	}
+
+	/**
+	 * \brief Columns high, high - 1, ..., low >= 1 of row n
+	 */
+	void columns(std::size_t n, std::size_t low, std::size_t high) {
+		// a local copy: stores into values can't change the modulus, no alias checks in the loops
+		const Arithmetic arithmetic = this->arithmetic;
+		switch (triangle) {
+		case Triangle::binomial:
+			descending(values, low, high, [&arithmetic](const Value& value, const Value& left, std::size_t) {
+				return arithmetic.add(value, left);
+			});
+			break;
+		case Triangle::stirling1: {
+			// c(n, k) = (n - 1) c(n - 1, k) + c(n - 1, k - 1)
+			const Multiplier factor = arithmetic.multiplier(n - 1);
+			descending(values, low, high, [&arithmetic, factor](const Value& value, const Value& left, std::size_t) {
+				return arithmetic.add(arithmetic.multiply(value, factor), left);
+			});
+			break;
+		}
+		default: {
+			const Multiplier* factors = column_multipliers.data();
+			descending(values, low, high, [&arithmetic, factors](const Value& value, const Value& left, std::size_t k) {
+				return arithmetic.add(arithmetic.multiply(value, factors[k]), left);
+			});
+			break;
+		}
+		}
+	}
+
+	/**
+	 * \brief Column 0 of row n >= 1, after column 1
+	 */
+	void first_column() {
+		if (triangle != Triangle::binomial) {
+			values[0] = Value{};
+		}
+	}
+
+	void row(std::size_t n) {
+		columns(n, 1, n);
+		first_column();
+	}
+
+	/**
+	 * \brief Advances values from row first to row last, in tiles if the rows are wider than a tile
+	 *
+	 * At step t (row first + t) tile j covers the columns [start + j width + t, start + (j + 1) width + t):
+	 * the tiles lean to the right, so a column of a step only needs columns of the previous step
+	 * from its own tile or the tile to the right. Tiles are processed from the right, each one for all steps.
+	 */
+	void rows(std::size_t first, std::size_t last) {
+		const Tiling tiles = tiling();
+		std::size_t n = first;
+		while (n < last) {
+			if (tiles.rows == 0 || tiles.columns == 0 || last < tiles.columns) {
+				row(++n);
+				continue;
+			}
+			const std::size_t steps = std::min(tiles.rows, last - n);
+			const std::ptrdiff_t width = static_cast<std::ptrdiff_t>(tiles.columns);
+			const std::ptrdiff_t start = 1 - static_cast<std::ptrdiff_t>(steps);
+			const std::ptrdiff_t count = static_cast<std::ptrdiff_t>(n + steps) / width + 1;
+			for (std::ptrdiff_t j = count; j-- > 0;) {
+				for (std::size_t t = 1; t <= steps; t++) {
+					const std::ptrdiff_t shift = start + static_cast<std::ptrdiff_t>(t);
+					const std::ptrdiff_t low = std::max<std::ptrdiff_t>(1, shift + j * width);
+					const std::ptrdiff_t high = std::min<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(n + t), shift + (j + 1) * width - 1);
+					if (low <= high) {
+						columns(n + t, static_cast<std::size_t>(low), static_cast<std::size_t>(high));
+						if (low == 1) {
+							first_column();
+						}
+					}
+				}
+			}
+			n += steps;
+		}
+	}
+};
+
+template<typename Arithmetic>
+constexpr bool is_modular = std::is_same<Arithmetic, Modular>::value;
+
+/**
+ * \brief value (factor / divisor) for an exact division, std::overflow_error if the result doesn't fit
+ */
+std::uint64_t multiply_divide(std::uint64_t value, std::uint64_t factor, std::uint64_t divisor) {
+	unsigned __int128 result = static_cast<unsigned __int128>(value) * factor / divisor;
+	if (result >> 64) {
+		throw std::overflow_error("combinatorial number doesn't fit into 64 bits");
+	}
+	return static_cast<std::uint64_t>(result);
+}
+
+/**
+ * \brief C(n, k + 1) = C(n, k) (n - k) / (k + 1) for the left half of the row, the right half is its mirror image
+ */
+template<typename Arithmetic>
+std::vector<typename Arithmetic::Value> binomial_row(std::size_t n, const Arithmetic& arithmetic) {
+	using Value = typename Arithmetic::Value;
+	std::vector<Value> values(n + 1);
+	Value value{1};
+	std::vector<Value> inverses;
+	if constexpr (is_modular<Arithmetic>) {
+		inverses = arithmetic.inverses(n / 2 + 1);
+	}
+	for (std::size_t k = 0; k <= n / 2; k++) {
+		values[k] = value;
+		values[n - k] = value;
+		if (k == n / 2) {
+			break;
+		}
+		if constexpr (is_modular<Arithmetic>) {
+			value = arithmetic.multiply(arithmetic.multiply(value, static_cast<Value>(n - k)), inverses[k + 1]);
+		} else if constexpr (std::is_same<Arithmetic, Word>::value) {
+			value = multiply_divide(value, n - k, k + 1);
+		} else {
+			value *= n - k;
+			value.divide(k + 1);
+		}
+	}
+	return values;
+}
+
+}
+
+const char* name(Triangle triangle) {
+	switch (triangle) {
+	case Triangle::binomial: return "binomial";
+	case Triangle::stirling1: return "stirling1";
+	default: return "stirling2";
+	}
+}
+
+Word::Value Word::add(Value a, Value b) const {
+	Value sum;
+	if (__builtin_add_overflow(a, b, &sum)) {
+		throw std::overflow_error("combinatorial number doesn't fit into 64 bits");
+	}
+	return sum;
+}
+
+Word::Value Word::multiply(Value a, Multiplier b) const {
+	Value product;
+	if (__builtin_mul_overflow(a, b, &product)) {
+		throw std::overflow_error("combinatorial number doesn't fit into 64 bits");
+	}
+	return product;
+}
+
+Modular::Modular(std::uint32_t modulus): _modulus{modulus}, _prime{modulus >= 2} {
+	if (modulus < 2 || modulus >= (1u << 31)) {
+		throw std::invalid_argument("modulus must be in [2, 2^31)");
+	}
+	for (std::uint32_t divisor = 2; _prime && divisor <= modulus / divisor; divisor++) {
+		_prime = modulus % divisor != 0;
+	}
+}
+
+Modular::Multiplier Modular::multiplier(std::uint64_t factor) const {
+	std::uint32_t reduced = static_cast<std::uint32_t>(factor % _modulus);
+	return Multiplier{reduced, static_cast<std::uint32_t>((std::uint64_t{reduced} << 32) / _modulus)};
+}
+
+std::vector<Modular::Value> Modular::inverses(std::size_t count) const {
+	if (!_prime || count > _modulus) {
+		throw std::domain_error("inverses need a prime modulus above the numbers");
+	}
+	std::vector<Value> result(std::max<std::size_t>(count, 2));
+	result[1] = 1;
+	for (std::size_t i = 2; i < count; i++) {
+		std::uint32_t quotient = _modulus / static_cast<std::uint32_t>(i);
+		result[i] = multiply(_modulus - quotient, result[_modulus % i]);
+	}
+	result.resize(count);
+	return result;
+}
+
+Tiling& tiling() {
+	static Tiling tiling;
+	return tiling;
+}
+
+template<typename Arithmetic>
+std::vector<typename Arithmetic::Value> row(Triangle triangle, std::size_t n, const Arithmetic& arithmetic) {
+	using Value = typename Arithmetic::Value;
+	if (triangle == Triangle::binomial) {
+		bool multiplicative = true;
+		if constexpr (is_modular<Arithmetic>) {
+			multiplicative = arithmetic.is_prime() && n < arithmetic.modulus();
+		}
+		if (multiplicative) {
+			return binomial_row(n, arithmetic);
+		}
+	}
+	std::vector<Value> values(n + 1);
+	values[0] = Value{1};
+	Sweep<Arithmetic>{triangle, arithmetic, values.data(), n}.rows(0, n);
+	return values;
+}
+
+template<typename Arithmetic>
+std::vector<std::vector<typename Arithmetic::Value>> triangle(Triangle triangle, std::size_t n, const Arithmetic& arithmetic) {
+	using Value = typename Arithmetic::Value;
+	std::vector<Value> values(n + 1);
+	values[0] = Value{1};
+	std::vector<std::vector<Value>> rows{{values[0]}};
+	Sweep<Arithmetic> sweep{triangle, arithmetic, values.data(), n};
+	for (std::size_t i = 1; i <= n; i++) {
+		sweep.row(i);
+		rows.emplace_back(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(i) + 1);
+	}
+	return rows;
+}
+
+template<typename Arithmetic>
+std::vector<typename Arithmetic::Value> bell_numbers(std::size_t count, const Arithmetic& arithmetic) {
+	using Value = typename Arithmetic::Value;
+	std::vector<Value> numbers;
+	std::vector<Value> previous{Value{1}};
+	std::vector<Value> current;
+	for (std::size_t i = 0; i < count; i++) {
+		numbers.push_back(previous[0]);
+		current.assign(1, previous.back());
+		for (std::size_t j = 1; j <= previous.size(); j++) {
+			current.push_back(arithmetic.add(current[j - 1], previous[j - 1]));
+		}
+		previous.swap(current);
+	}
+	return numbers;
+}
+
+template<typename Arithmetic>
+std::vector<typename Arithmetic::Value> catalan_numbers(std::size_t count, const Arithmetic& arithmetic) {
+	using Value = typename Arithmetic::Value;
+	std::vector<Value> numbers;
+	if constexpr (is_modular<Arithmetic>) {
+		if (!arithmetic.is_prime() || count >= arithmetic.modulus()) {
+			// ballot numbers: b(n, k) = b(n, k - 1) + b(n - 1, k) for k < n, b(n, n) = b(n, n - 1) = C(n)
+			std::vector<Value> ballot{Value{1}};
+			for (std::size_t n = 0; n < count; n++) {
+				if (n > 0) {
+					for (std::size_t k = 1; k < n; k++) {
+						ballot[k] = arithmetic.add(ballot[k], ballot[k - 1]);
+					}
+					ballot.push_back(ballot[n - 1]);
+				}
+				numbers.push_back(ballot[n]);
+			}
+			return numbers;
+		}
+	}
+	Value value{1};
+	std::vector<Value> inverses;
+	if constexpr (is_modular<Arithmetic>) {
+		inverses = arithmetic.inverses(count + 1);
+	}
+	for (std::size_t n = 0; n < count; n++) {
+		numbers.push_back(value);
+		if (n + 1 == count) {
+			break;
+		}
+		if constexpr (is_modular<Arithmetic>) {
+			value = arithmetic.multiply(arithmetic.multiply(value, static_cast<Value>(2 * (2 * n + 1) % arithmetic.modulus())), inverses[n + 2]);
+		} else if constexpr (std::is_same<Arithmetic, Word>::value) {
+			value = multiply_divide(value, 2 * (2 * n + 1), n + 2);
+		} else {
+			value *= 2 * (2 * n + 1);
+			value.divide(n + 2);
+		}
+	}
+	return numbers;
+}
+
+#define COMBINATORICS_INSTANTIATE(Arithmetic) \
+	template std::vector<Arithmetic::Value> row<Arithmetic>(Triangle, std::size_t, const Arithmetic&); \
+	template std::vector<std::vector<Arithmetic::Value>> triangle<Arithmetic>(Triangle, std::size_t, const Arithmetic&); \
+	template std::vector<Arithmetic::Value> bell_numbers<Arithmetic>(std::size_t, const Arithmetic&); \
+	template std::vector<Arithmetic::Value> catalan_numbers<Arithmetic>(std::size_t, const Arithmetic&);
+
+COMBINATORICS_INSTANTIATE(Word)
+COMBINATORICS_INSTANTIATE(Modular)
+COMBINATORICS_INSTANTIATE(Big)
+
+}
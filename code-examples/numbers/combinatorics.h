@@ -0,0 +1,179 @@
+/*
+ * combinatorics.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_NUMBERS_COMBINATORICS_H_
+#define CODE_EXAMPLES_NUMBERS_COMBINATORICS_H_
+
+#include "big_unsigned.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * \brief Whole rows and triangles of binomial coefficients and Stirling numbers, Bell and Catalan numbers
+ *
+ * Every function takes the arithmetic of the values:
+ *
+ *     combinatorics::row(Triangle::binomial, 60, Word{})                  exact, std::overflow_error above 2^64
+ *     combinatorics::row(Triangle::stirling2, 100000, Modular{998244353}) modulo a number below 2^31
+ *     combinatorics::row(Triangle::binomial, 10000, Big{})                BigUnsigned
+ *
+ * The triangles are computed with their recurrences, row n from row n - 1 in place from the right,
+ * for example S2(n, k) = k S2(n - 1, k) + S2(n - 1, k - 1). The modular inner loop has no branches
+ * (the reduction is a min of unsigned values, multiplication by a known factor uses Shoup's precomputed
+ * quotient), so the compiler vectorizes it: GCC 12 the binomial additions at -O2, the Stirling
+ * multiplications (high halves of 32-bit products) from -O3. Rows wider than a tile are swept
+ * in parallelogram tiles: a tile of columns is advanced by many rows while it stays in L1, then
+ * the tile to its left follows. With AVX2 the untiled binomial sweep is limited by L2 bandwidth
+ * already for rows of 1e5 (bench_combinatorics).
+ */
+namespace combinatorics {
+
+enum class Triangle {
+	binomial,	/**< C(n, k) */
+	stirling1,	/**< Unsigned Stirling numbers of the first kind: permutations of n with k cycles */
+	stirling2	/**< Stirling numbers of the second kind: partitions of n into k blocks */
+};
+
+const char* name(Triangle triangle);
+
+/**
+ * \brief Exact values in 64 bits
+ * \throw std::overflow_error (from the functions below) when a value doesn't fit
+ */
+struct Word {
+	using Value = std::uint64_t;
+	using Multiplier = std::uint64_t;
+
+	Value add(Value a, Value b) const;
+	Multiplier multiplier(std::uint64_t factor) const {
+		return factor;
+	}
+	Value multiply(Value a, Multiplier b) const;
+};
+
+/**
+ * \brief Values modulo 2 <= modulus < 2^31, so that a sum of two fits in 32 bits
+ */
+class Modular {
+public:
+	using Value = std::uint32_t;
+
+	/**
+	 * \brief Factor with Shoup's quotient floor(factor 2^32 / modulus)
+	 */
+	struct Multiplier {
+		std::uint32_t factor;
+		std::uint32_t quotient;
+	};
+private:
+	std::uint32_t _modulus;
+	bool _prime;
+public:
+	/**
+	 * \throw std::invalid_argument if modulus is out of range
+	 */
+	explicit Modular(std::uint32_t modulus);
+
+	std::uint32_t modulus() const {
+		return _modulus;
+	}
+
+	bool is_prime() const {
+		return _prime;
+	}
+
+	Value add(Value a, Value b) const {
+		std::uint32_t sum = a + b;
+		std::uint32_t reduced = sum - _modulus;
+		return reduced < sum ? reduced : sum; // sum - modulus wraps around if sum < modulus
+	}
+
+	Multiplier multiplier(std::uint64_t factor) const;
+
+	Value multiply(Value a, Value b) const {
+		return static_cast<Value>(std::uint64_t{a} * b % _modulus);
+	}
+
+	Value multiply(Value a, Multiplier b) const {
+		std::uint32_t quotient = static_cast<std::uint32_t>((std::uint64_t{a} * b.quotient) >> 32);
+		std::uint32_t product = a * b.factor - quotient * _modulus; // in [0, 2 modulus)
+		std::uint32_t reduced = product - _modulus;
+		return reduced < product ? reduced : product;
+	}
+
+	/**
+	 * \brief Inverses of 1, ..., count - 1 (index 0 holds 0) by inverse(i) = -(m / i) inverse(m % i)
+	 * \throw std::domain_error if the modulus is not a prime above count - 1
+	 */
+	std::vector<Value> inverses(std::size_t count) const;
+};
+
+/**
+ * \brief Exact values of any size
+ */
+struct Big {
+	using Value = BigUnsigned;
+	using Multiplier = std::uint64_t;
+
+	Value add(Value a, const Value& b) const {
+		return a += b;
+	}
+	Multiplier multiplier(std::uint64_t factor) const {
+		return factor;
+	}
+	Value multiply(Value a, Multiplier b) const {
+		return a *= b;
+	}
+};
+
+/**
+ * \brief Parallelogram tiles of the sweeps over rows: columns and rows per tile
+ *
+ * Rows narrower than a tile are swept whole, 0 rows disables tiling.
+ */
+struct Tiling {
+	std::size_t columns = 8192;	/**< 32 KiB of values */
+	std::size_t rows = 256;
+};
+
+Tiling& tiling();
+
+/**
+ * \brief Row n of the triangle: values for k = 0, ..., n
+ *
+ * Binomial rows use C(n, k + 1) = C(n, k) (n - k) / (k + 1) in O(n) for Word, Big,
+ * and for Modular with a prime modulus above n; otherwise all rows are swept.
+ */
+template<typename Arithmetic>
+std::vector<typename Arithmetic::Value> row(Triangle triangle, std::size_t n, const Arithmetic& arithmetic = Arithmetic{});
+
+/**
+ * \brief Rows 0, ..., n of the triangle in one pass
+ */
+template<typename Arithmetic>
+std::vector<std::vector<typename Arithmetic::Value>> triangle(Triangle triangle, std::size_t n, const Arithmetic& arithmetic = Arithmetic{});
+
+/**
+ * \brief Bell numbers B(0), ..., B(count - 1) from the Bell triangle (each row starts with the last entry of the previous one)
+ */
+template<typename Arithmetic>
+std::vector<typename Arithmetic::Value> bell_numbers(std::size_t count, const Arithmetic& arithmetic = Arithmetic{});
+
+/**
+ * \brief Catalan numbers C(0), ..., C(count - 1)
+ *
+ * C(n + 1) = C(n) 2 (2n + 1) / (n + 2) for Word, Big and Modular with a prime modulus above count,
+ * otherwise with the ballot numbers (the triangle of paths which stay above the diagonal, additions only).
+ */
+template<typename Arithmetic>
+std::vector<typename Arithmetic::Value> catalan_numbers(std::size_t count, const Arithmetic& arithmetic = Arithmetic{});
+
+}
+
+#endif /* CODE_EXAMPLES_NUMBERS_COMBINATORICS_H_ */
@@ -0,0 +1,149 @@
+/*
+ * combinatorics_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "combinatorics.h"
+#include "../commands.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace bench_combinatorics {
+
+using combinatorics::Big;
+using combinatorics::Modular;
+using combinatorics::Triangle;
+using combinatorics::Word;
+
+constexpr std::uint32_t prime = 998244353;
+constexpr std::uint32_t composite = 1000000000;
+
+template<typename Function>
+double seconds(Function function) {
+	auto begin = std::chrono::steady_clock::now();
+	function();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+void report(const std::string& what, std::size_t n, double seconds, std::size_t entries) {
+	std::cout<<what<<"\t"<<n<<"\t"<<seconds<<"\t"<<seconds * 1e9 / static_cast<double>(entries)<<std::endl;
+}
+
+std::uint64_t factorial(unsigned n) {
+	std::uint64_t result = 1;
+	for (unsigned i = 2; i <= n; i++) {
+		result *= i;
+	}
+	return result;
+}
+
+std::uint32_t factorial(std::size_t n, const Modular& modular) {
+	std::uint32_t result = 1;
+	for (std::size_t i = 2; i <= n; i++) {
+		result = modular.multiply(result, static_cast<std::uint32_t>(i));
+	}
+	return result;
+}
+
+std::uint32_t power(std::uint32_t base, std::uint32_t exponent, const Modular& modular) {
+	std::uint32_t result = 1;
+	for (; exponent; exponent >>= 1, base = modular.multiply(base, base)) {
+		if (exponent & 1) {
+			result = modular.multiply(result, base);
+		}
+	}
+	return result;
+}
+
+// usage: bench_combinatorics [n]
+// rows of n + 1 entries (default 100000, big integers n / 10), times in seconds and ns per entry;
+// the per entry columns are measured on 50 entries of the row and scaled to the whole row
+int main(int argc, char** argv) {
+	std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+	const std::size_t samples = 50;
+	const Modular modular_prime{prime};
+	const Modular modular_composite{composite};
+	std::vector<std::uint32_t> values;
+	std::uint64_t checksum = 0;
+
+	std::cout<<"what\tn\tseconds\tns per entry"<<std::endl;
+
+	// words: a row of 21 entries many times
+	const std::size_t repetitions = 100000;
+	report("word binomial row", 20, seconds([&]() {
+		for (std::size_t i = 0; i < repetitions; i++) {
+			checksum += combinatorics::row(Triangle::binomial, 20, Word{})[i % 21];
+		}
+	}), 21 * repetitions);
+	report("word per entry factorial", 20, seconds([&]() {
+		for (std::size_t i = 0; i < repetitions; i++) {
+			for (unsigned k = 0; k <= 20; k++) {
+				checksum += factorial(20) / (factorial(k) * factorial(20 - k));
+			}
+		}
+	}), 21 * repetitions);
+
+	// modular rows
+	report("mod prime binomial row (inverses)", n, seconds([&]() {
+		values = combinatorics::row(Triangle::binomial, n, modular_prime);
+	}), n + 1);
+	double per_entry = seconds([&]() {
+		for (std::size_t sample = 0; sample < samples; sample++) {
+			std::size_t k = sample * n / samples;
+			std::uint32_t denominator = modular_prime.multiply(factorial(k, modular_prime), factorial(n - k, modular_prime));
+			std::uint32_t value = modular_prime.multiply(factorial(n, modular_prime), power(denominator, prime - 2, modular_prime));
+			checksum += value == values[k];
+		}
+	});
+	report("mod prime per entry factorial", n, per_entry * static_cast<double>(n + 1) / samples, n + 1);
+
+	combinatorics::Tiling tiling = combinatorics::tiling();
+	for (Triangle triangle: {Triangle::binomial, Triangle::stirling1, Triangle::stirling2}) {
+		std::string name = combinatorics::name(triangle);
+		report("mod 1e9 " + name + " row swept in tiles", n, seconds([&]() {
+			values = combinatorics::row(triangle, n, modular_composite);
+		}), n * (n + 1) / 2);
+		checksum += values[n / 2];
+		combinatorics::tiling().rows = 0;
+		report("mod 1e9 " + name + " row swept untiled", n, seconds([&]() {
+			values = combinatorics::row(triangle, n, modular_composite);
+		}), n * (n + 1) / 2);
+		checksum += values[n / 2];
+		combinatorics::tiling() = tiling;
+	}
+
+	// big integers
+	const std::size_t big_n = n / 10;
+	std::vector<BigUnsigned> big_values;
+	report("big binomial row", big_n, seconds([&]() {
+		big_values = combinatorics::row(Triangle::binomial, big_n, Big{});
+	}), big_n + 1);
+	// BigUnsigned has no long division, so n! / (k! (n - k)!) is checked as C(n, k) k! (n - k)! == n!,
+	// a multiplication of the same size: a lower bound for the per entry cost
+	per_entry = seconds([&]() {
+		for (std::size_t sample = 0; sample < samples; sample++) {
+			std::size_t k = sample * big_n / samples;
+			BigUnsigned n_factorial = BigUnsigned::factorial(static_cast<unsigned>(big_n));
+			BigUnsigned denominator = BigUnsigned::factorial(static_cast<unsigned>(k)) * BigUnsigned::factorial(static_cast<unsigned>(big_n - k));
+			checksum += big_values[k] * denominator == n_factorial;
+		}
+	});
+	report("big per entry factorial", big_n, per_entry * static_cast<double>(big_n + 1) / samples, big_n + 1);
+	report("big stirling2 row", big_n / 10, seconds([&]() {
+		big_values = combinatorics::row(Triangle::stirling2, big_n / 10, Big{});
+	}), big_n / 10 * (big_n / 10 + 1) / 2);
+
+	std::cout<<"checksum "<<checksum<<std::endl;
+	return 0;
+}
+
+static commands::Registrar registrar{"bench_combinatorics", commands::Kind::benchmark, main,
+		"binomial and Stirling rows (word, modular, big) against factorials per entry", {"20000"}};
+
+}
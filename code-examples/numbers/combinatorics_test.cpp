@@ -0,0 +1,126 @@
+/*
+ * combinatorics_test.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "combinatorics.h"
+
+#include "../doctest.h"
+
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using combinatorics::Big;
+using combinatorics::Modular;
+using combinatorics::Triangle;
+using combinatorics::Word;
+
+namespace {
+
+std::vector<std::uint32_t> reduce(const std::vector<BigUnsigned>& values, std::uint32_t modulus) {
+	std::vector<std::uint32_t> result;
+	for (BigUnsigned value: values) {
+		result.push_back(static_cast<std::uint32_t>(value.divide(modulus)));
+	}
+	return result;
+}
+
+/**
+ * \brief Restores the tiling when a test case ends
+ */
+struct TilingGuard {
+	combinatorics::Tiling saved = combinatorics::tiling();
+	~TilingGuard() {
+		combinatorics::tiling() = saved;
+	}
+};
+
+}
+
+TEST_CASE("[combinatorics] - small values") {
+	using Values = std::vector<std::uint64_t>;
+	CHECK(combinatorics::row(Triangle::binomial, 0, Word{}) == Values{1});
+	CHECK(combinatorics::row(Triangle::binomial, 6, Word{}) == Values{1, 6, 15, 20, 15, 6, 1});
+	CHECK(combinatorics::row(Triangle::stirling1, 5, Word{}) == Values{0, 24, 50, 35, 10, 1});
+	CHECK(combinatorics::row(Triangle::stirling2, 5, Word{}) == Values{0, 1, 15, 25, 10, 1});
+	CHECK(combinatorics::bell_numbers(9, Word{}) == Values{1, 1, 2, 5, 15, 52, 203, 877, 4140});
+	CHECK(combinatorics::catalan_numbers(10, Word{}) == Values{1, 1, 2, 5, 14, 42, 132, 429, 1430, 4862});
+	CHECK(combinatorics::catalan_numbers(0, Word{}).empty());
+
+	auto rows = combinatorics::triangle(Triangle::stirling2, 4, Word{});
+	REQUIRE(rows.size() == 5);
+	CHECK(rows[0] == Values{1});
+	CHECK(rows[3] == Values{0, 1, 3, 1});
+	CHECK(rows[4] == Values{0, 1, 7, 6, 1});
+	CHECK(std::string{combinatorics::name(Triangle::stirling1)} == "stirling1");
+}
+
+TEST_CASE("[combinatorics] - word overflow") {
+	std::vector<std::uint64_t> row = combinatorics::row(Triangle::binomial, 67, Word{});
+	CHECK(row[33] == 14226520737620288370ULL);
+	CHECK_THROWS_AS(combinatorics::row(Triangle::binomial, 68, Word{}), std::overflow_error);
+	CHECK_THROWS_AS(combinatorics::row(Triangle::stirling2, 40, Word{}), std::overflow_error);
+	CHECK_THROWS_AS(combinatorics::catalan_numbers(40, Word{}), std::overflow_error);
+	CHECK(combinatorics::catalan_numbers(36, Word{}).back() == 3116285494907301262ULL);
+
+	// the multiplicative row agrees with the triangle
+	auto rows = combinatorics::triangle(Triangle::binomial, 67, Word{});
+	for (std::size_t n: {1, 2, 30, 67}) {
+		CAPTURE(n);
+		CHECK(combinatorics::row(Triangle::binomial, n, Word{}) == rows[n]);
+	}
+}
+
+TEST_CASE("[combinatorics] - modular and big agree") {
+	const std::uint32_t prime = 998244353;
+	const std::uint32_t composite = 1000000000;
+	CHECK(Modular{prime}.is_prime());
+	CHECK_FALSE(Modular{composite}.is_prime());
+	CHECK_THROWS_AS(Modular{1}, std::invalid_argument);
+	CHECK_THROWS_AS(Modular{1u << 31}, std::invalid_argument);
+	CHECK_THROWS_AS(Modular{composite}.inverses(10), std::domain_error);
+	CHECK(Modular{7}.inverses(7) == std::vector<std::uint32_t>{0, 1, 4, 5, 2, 3, 6});
+
+	for (Triangle triangle: {Triangle::binomial, Triangle::stirling1, Triangle::stirling2}) {
+		CAPTURE(combinatorics::name(triangle));
+		for (std::size_t n: {0, 1, 2, 150, 300}) {
+			CAPTURE(n);
+			std::vector<BigUnsigned> exact = combinatorics::row(triangle, n, Big{});
+			CHECK(combinatorics::row(triangle, n, Modular{prime}) == reduce(exact, prime));
+			CHECK(combinatorics::row(triangle, n, Modular{composite}) == reduce(exact, composite));
+		}
+	}
+	// small prime: the binomial row is swept, not computed with inverses
+	CHECK(combinatorics::row(Triangle::binomial, 20, Modular{7}) == reduce(combinatorics::row(Triangle::binomial, 20, Big{}), 7));
+
+	std::vector<BigUnsigned> catalan = combinatorics::catalan_numbers(200, Big{});
+	CHECK(combinatorics::catalan_numbers(200, Modular{prime}) == reduce(catalan, prime));
+	CHECK(combinatorics::catalan_numbers(200, Modular{composite}) == reduce(catalan, composite));
+	CHECK(combinatorics::catalan_numbers(200, Modular{101}) == reduce(catalan, 101));
+
+	// B(n) is the sum of S2(n, k)
+	std::vector<BigUnsigned> bell = combinatorics::bell_numbers(80, Big{});
+	std::vector<BigUnsigned> partitions = combinatorics::row(Triangle::stirling2, 79, Big{});
+	CHECK(bell.back() == std::accumulate(partitions.begin(), partitions.end(), BigUnsigned{}));
+	CHECK(combinatorics::bell_numbers(80, Modular{composite}) == reduce(bell, composite));
+}
+
+TEST_CASE("[combinatorics] - tiled sweeps") {
+	TilingGuard guard;
+	const Modular modular{1000000000};
+	for (Triangle triangle: {Triangle::binomial, Triangle::stirling1, Triangle::stirling2}) {
+		CAPTURE(combinatorics::name(triangle));
+		combinatorics::tiling() = combinatorics::Tiling{1, 0};
+		std::vector<std::uint32_t> untiled = combinatorics::row(triangle, 1000, modular);
+		for (combinatorics::Tiling tiling: {combinatorics::Tiling{7, 3}, combinatorics::Tiling{64, 100}, combinatorics::Tiling{1, 1}, combinatorics::Tiling{999, 2000}}) {
+			CAPTURE(tiling.columns);
+			CAPTURE(tiling.rows);
+			combinatorics::tiling() = tiling;
+			CHECK(combinatorics::row(triangle, 1000, modular) == untiled);
+		}
+	}
+}
@@ -0,0 +1,34 @@
+/*
+ * factorial.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "big_unsigned.h"
+#include "../commands.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace factorial_example {
+
+// usage: factorial [n] [--count]
+// prints n! in decimal (or only the number of its digits), int holds only up to 12!, 64 bits up to 20!
+int main(int argc, char** argv) {
+	unsigned n = argc > 1 ? static_cast<unsigned>(std::strtoul(argv[1], nullptr, 10)) : 100;
+	bool count_only = argc > 2 && std::string{argv[2]} == "--count";
+
+	std::string digits = BigUnsigned::factorial(n).to_string();
+	if (count_only) {
+		std::cout<<n<<"! has "<<digits.size()<<" digits"<<std::endl;
+	} else {
+		std::cout<<n<<"! = "<<digits<<std::endl;
+	}
+	return 0;
+}
+
+static commands::Registrar registrar{"factorial", commands::Kind::example, main, "n! in decimal for any n (factorial 100000 --count)"};
+
+}
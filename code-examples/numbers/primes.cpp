@@ -0,0 +1,320 @@
+/*
+ * primes.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "primes.h"
+#include "../concurrency/parallel.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+namespace primes {
+
+namespace {
+
+constexpr std::uint32_t residues[8] = {1, 7, 11, 13, 17, 19, 23, 29};	/**< numbers of bits 0..7 of a byte, mod 30 */
+
+constexpr int bit_of(std::uint64_t residue) {
+	for (int bit = 0; bit < 8; bit++) {
+		if (residues[bit] == residue) {
+			return bit;
+		}
+	}
+	return -1;
+}
+
+std::uint64_t isqrt(std::uint64_t n) {
+	auto root = static_cast<std::uint64_t>(std::sqrt(static_cast<double>(n)));
+	while (root * root > n) {
+		root--;
+	}
+	while (root < UINT32_MAX && (root + 1) * (root + 1) <= n) {
+		root++;
+	}
+	return root;
+}
+
+constexpr std::size_t pattern_bytes = 7 * 11 * 13;
+
+/**
+ * \brief Bytes with the bits of numbers coprime to 7, 11 and 13, it repeats every 30 * 1001 numbers
+ */
+const std::array<unsigned char, pattern_bytes>& presieve_pattern() {
+	static const std::array<unsigned char, pattern_bytes> pattern = []() {
+		std::array<unsigned char, pattern_bytes> pattern;
+		for (std::size_t byte = 0; byte < pattern_bytes; byte++) {
+			unsigned bits = 0;
+			for (int bit = 0; bit < 8; bit++) {
+				std::uint64_t number = byte * 30 + residues[bit];
+				if (number % 7 && number % 11 && number % 13) {
+					bits |= 1u << bit;
+				}
+			}
+			pattern[byte] = static_cast<unsigned char>(bits);
+		}
+		return pattern;
+	}();
+	return pattern;
+}
+
+constexpr std::uint32_t first_sieving_prime = 17; // smaller ones are in the wheel and the pattern
+
+/**
+ * \brief Sieves consecutive segments starting from a given byte
+ *
+ * The multiples p*k of a sieving prime with the multiplier k in one residue class mod 30 fall into the same
+ * bit and are 30*p numbers (p bytes) apart, so each prime has 8 arithmetic progressions of bytes.
+ * Crossing off starts at p*p, the smaller multiples have a smaller prime factor.
+ */
+class SegmentSieve {
+private:
+	struct SievingPrime {
+		std::uint32_t prime;
+		std::uint64_t offset[8];	/**< next multiple of each progression, bytes from the next segment */
+		unsigned char mask[8];		/**< clears the bit of that multiple */
+	};
+
+	std::vector<SievingPrime> sieving_primes;
+	std::uint64_t low;				/**< first byte of the next segment */
+public:
+	/**
+	 * \param primes ascending, at least all primes up to isqrt(limit)
+	 * \param first_byte number 30 * first_byte starts the first segment
+	 */
+	SegmentSieve(const std::vector<std::uint32_t>& primes, std::uint64_t first_byte, std::uint64_t limit): low{first_byte} {
+		std::uint64_t first_number = first_byte * 30;
+		for (std::uint32_t prime: primes) {
+			if (prime < first_sieving_prime) {
+				continue;
+			}
+			if (std::uint64_t{prime} * prime > limit) {
+				break;
+			}
+			SievingPrime sieving{prime, {}, {}};
+			std::uint64_t start = std::max<std::uint64_t>(prime, (first_number + prime - 1) / prime);
+			for (int j = 0; j < 8; j++) {
+				std::uint64_t multiplier = start + (residues[j] + 30 - start % 30) % 30;
+				std::uint64_t multiple = multiplier * prime;
+				sieving.offset[j] = multiple / 30 - first_byte;
+				sieving.mask[j] = static_cast<unsigned char>(~(1u << bit_of(multiple % 30)));
+			}
+			sieving_primes.push_back(sieving);
+		}
+	}
+
+	/**
+	 * \brief Sieve the next size bytes into bits: a bit stays set if its number is prime
+	 */
+	void sieve_next(unsigned char* bits, std::size_t size) {
+		const auto& pattern = presieve_pattern();
+		std::size_t position = low % pattern_bytes;
+		for (std::size_t done = 0; done < size; position = 0) {
+			std::size_t count = std::min(size - done, pattern_bytes - position);
+			std::memcpy(bits + done, pattern.data() + position, count);
+			done += count;
+		}
+		if (low == 0) {
+			bits[0] = static_cast<unsigned char>((bits[0] & ~1u) | 0b1110u); // 1 is not prime, 7, 11 and 13 are
+		}
+		for (SievingPrime& sieving: sieving_primes) {
+			const std::uint32_t prime = sieving.prime;
+			for (int j = 0; j < 8; j++) {
+				std::uint64_t offset = sieving.offset[j];
+				const unsigned char mask = sieving.mask[j];
+				for (; offset < size; offset += prime) {
+					bits[offset] &= mask;
+				}
+				sieving.offset[j] = offset - size;
+			}
+		}
+		low += size;
+	}
+};
+
+/**
+ * \brief Bits of the byte of n for numbers <= n
+ */
+unsigned char mask_up_to(std::uint64_t n) {
+	unsigned mask = 0;
+	for (int bit = 0; bit < 8; bit++) {
+		if (residues[bit] <= n % 30) {
+			mask |= 1u << bit;
+		}
+	}
+	return static_cast<unsigned char>(mask);
+}
+
+std::uint64_t count_bits(const unsigned char* bits, std::size_t size) {
+	std::uint64_t count = 0;
+	std::size_t i = 0;
+	for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)) {
+		std::uint64_t word;
+		std::memcpy(&word, bits + i, sizeof(word));
+		count += static_cast<std::uint64_t>(__builtin_popcountll(word));
+	}
+	for (; i < size; i++) {
+		count += static_cast<std::uint64_t>(__builtin_popcount(bits[i]));
+	}
+	return count;
+}
+
+std::uint64_t wheel_primes_up_to(std::uint64_t n) {
+	return (n >= 2) + (n >= 3) + (n >= 5);
+}
+
+/**
+ * \brief Primes <= n in the segments [first_segment, last_segment), except 2, 3 and 5
+ */
+std::uint64_t count_segments(const std::vector<std::uint32_t>& sieving_primes, std::uint64_t n,
+		std::uint64_t first_segment, std::uint64_t last_segment) {
+	const std::uint64_t total_bytes = n / 30 + 1;
+	const std::uint64_t end_byte = std::min(total_bytes, last_segment * segment_bytes);
+	std::vector<unsigned char> bits(segment_bytes);
+	SegmentSieve sieve{sieving_primes, first_segment * segment_bytes, n};
+	std::uint64_t count = 0;
+	for (std::uint64_t byte = first_segment * segment_bytes; byte < end_byte; byte += segment_bytes) {
+		std::size_t size = static_cast<std::size_t>(std::min<std::uint64_t>(segment_bytes, end_byte - byte));
+		sieve.sieve_next(bits.data(), size);
+		if (byte + size == total_bytes) {
+			bits[size - 1] &= mask_up_to(n);
+		}
+		count += count_bits(bits.data(), size);
+	}
+	return count;
+}
+
+std::uint64_t segment_count(std::uint64_t n) {
+	return (n / 30 + 1 + segment_bytes - 1) / segment_bytes;
+}
+
+}
+
+std::vector<std::uint32_t> simple_sieve(std::uint32_t limit) {
+	std::vector<std::uint32_t> primes;
+	std::vector<unsigned char> composite(std::size_t{limit} + 1);
+	for (std::uint64_t number = 2; number <= limit; number++) {
+		if (composite[number]) {
+			continue;
+		}
+		primes.push_back(static_cast<std::uint32_t>(number));
+		for (std::uint64_t multiple = number * number; multiple <= limit; multiple += number) {
+			composite[multiple] = 1;
+		}
+	}
+	return primes;
+}
+
+std::uint64_t pi(std::uint64_t n) {
+	if (n < 2) {
+		return 0;
+	}
+	std::vector<std::uint32_t> sieving_primes = simple_sieve(static_cast<std::uint32_t>(isqrt(n)));
+	return wheel_primes_up_to(n) + count_segments(sieving_primes, n, 0, segment_count(n));
+}
+
+std::uint64_t pi(std::uint64_t n, ThreadPool& pool) {
+	if (n < 2) {
+		return 0;
+	}
+	std::vector<std::uint32_t> sieving_primes = simple_sieve(static_cast<std::uint32_t>(isqrt(n)));
+	// every range of segments sets up the sieving primes again, automatic grain keeps that cost small
+	std::uint64_t count = parallel_reduce(pool, std::uint64_t{0}, segment_count(n), std::uint64_t{0}, std::uint64_t{0},
+		[&](std::uint64_t from, std::uint64_t to, std::uint64_t count) {
+			return count + count_segments(sieving_primes, n, from, to);
+		},
+		[](std::uint64_t a, std::uint64_t b) {
+			return a + b;
+		});
+	return wheel_primes_up_to(n) + count;
+}
+
+/**
+ * \brief Produces the primes of a Range one at a time, sieving the next segment when the current one is used up
+ */
+class Generator {
+private:
+	std::uint64_t from;
+	std::uint64_t to;
+	SegmentSieve sieve;
+	std::vector<unsigned char> bits;
+	std::uint64_t segment_low;		/**< first byte of bits */
+	std::size_t size = 0;			/**< sieved bytes in bits */
+	std::size_t position = 0;		/**< next byte to read */
+	std::uint64_t current = 0;		/**< byte of pending */
+	unsigned pending = 0;			/**< bits of current which have not been returned */
+	int wheel_index = 0;			/**< 2, 3 and 5 come first */
+	bool done;
+public:
+	Generator(std::uint64_t from, std::uint64_t to):
+		from{from}, to{to},
+		sieve{simple_sieve(static_cast<std::uint32_t>(isqrt(to))), from / 30, to},
+		bits(segment_bytes), segment_low{from / 30}, done{from > to} {}
+
+	/**
+	 * \return false when there are no more primes
+	 */
+	bool next(std::uint64_t& prime) {
+		static constexpr std::uint64_t wheel_primes[3] = {2, 3, 5};
+		while (!done && wheel_index < 3) {
+			std::uint64_t value = wheel_primes[wheel_index++];
+			if (value >= from && value <= to) {
+				prime = value;
+				return true;
+			}
+		}
+		while (!done) {
+			if (pending) {
+				int bit = __builtin_ctz(pending);
+				pending &= pending - 1;
+				std::uint64_t value = current * 30 + residues[bit];
+				if (value > to) {
+					done = true;
+				} else if (value >= from) {
+					prime = value;
+					return true;
+				}
+				continue;
+			}
+			if (position == size) {
+				segment_low += size;
+				if (segment_low > to / 30) {
+					done = true;
+					break;
+				}
+				size = static_cast<std::size_t>(std::min<std::uint64_t>(segment_bytes, to / 30 + 1 - segment_low));
+				sieve.sieve_next(bits.data(), size);
+				position = 0;
+			}
+			current = segment_low + position;
+			pending = bits[position++];
+		}
+		return false;
+	}
+};
+
+PrimeIterator::PrimeIterator(std::shared_ptr<Generator> generator): generator{std::move(generator)} {
+	++*this;
+}
+
+PrimeIterator& PrimeIterator::operator++() {
+	if (generator && !generator->next(value)) {
+		generator.reset();
+	}
+	return *this;
+}
+
+PrimeIterator Range::begin() const {
+	return PrimeIterator{std::make_shared<Generator>(from, to)};
+}
+
+std::vector<std::uint64_t> between(std::uint64_t from, std::uint64_t to) {
+	Range range{from, to};
+	return std::vector<std::uint64_t>(range.begin(), range.end());
+}
+
+}
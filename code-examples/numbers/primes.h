@@ -0,0 +1,116 @@
+/*
+ * primes.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_NUMBERS_PRIMES_H_
+#define CODE_EXAMPLES_NUMBERS_PRIMES_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+class ThreadPool;
+
+/**
+ * \brief Segmented sieve of Eratosthenes with a 2*3*5 wheel
+ *
+ * Only numbers coprime to 30 are stored: a byte holds 30 numbers, one bit for each of the residues
+ * 1, 7, 11, 13, 17, 19, 23, 29. The sieve runs over segments of segment_bytes (L1 data cache sized),
+ * each starts from a copy of a pattern with the multiples of 7, 11 and 13 removed, then the multiples
+ * of larger primes are crossed off; every sieving prime remembers where its multiples continue in
+ * the next segment. Segments are independent, so pi() can sieve ranges of segments in parallel.
+ */
+namespace primes {
+
+constexpr std::size_t segment_bytes = 32 * 1024;	/**< 983040 numbers per segment */
+
+/**
+ * \brief Primes up to limit (inclusive) by the plain sieve of Eratosthenes, a byte per number
+ *
+ * Gives the sieving primes and the reference for tests.
+ */
+std::vector<std::uint32_t> simple_sieve(std::uint32_t limit);
+
+/**
+ * \brief Number of primes <= n, one thread
+ */
+std::uint64_t pi(std::uint64_t n);
+
+/**
+ * \brief Number of primes <= n, ranges of segments are sieved by the threads of pool
+ */
+std::uint64_t pi(std::uint64_t n, ThreadPool& pool);
+
+class Generator;
+
+/**
+ * \brief Single pass input iterator over the primes of a Range, like std::istream_iterator
+ */
+class PrimeIterator {
+private:
+	std::shared_ptr<Generator> generator;	/**< nullptr for the end iterator */
+	std::uint64_t value = 0;
+public:
+	using iterator_category = std::input_iterator_tag;
+	using value_type = std::uint64_t;
+	using difference_type = std::ptrdiff_t;
+	using pointer = const std::uint64_t*;
+	using reference = const std::uint64_t&;
+
+	PrimeIterator() = default;
+	explicit PrimeIterator(std::shared_ptr<Generator> generator);
+
+	reference operator*() const {
+		return value;
+	}
+	pointer operator->() const {
+		return &value;
+	}
+	PrimeIterator& operator++();
+	PrimeIterator operator++(int) {
+		PrimeIterator previous = *this;
+		++*this;
+		return previous;
+	}
+
+	friend bool operator==(const PrimeIterator& a, const PrimeIterator& b) {
+		return a.generator == b.generator;
+	}
+	friend bool operator!=(const PrimeIterator& a, const PrimeIterator& b) {
+		return !(a == b);
+	}
+};
+
+/**
+ * \brief Primes in [from, to], sieved a segment at a time while iterating
+ *
+ *     for (std::uint64_t prime: primes::Range{1000000000, 1000001000}) { ... }
+ *
+ * Every begin() starts a new pass.
+ */
+class Range {
+private:
+	std::uint64_t from;
+	std::uint64_t to;
+public:
+	Range(std::uint64_t from, std::uint64_t to): from{from}, to{to} {}
+
+	PrimeIterator begin() const;
+	PrimeIterator end() const {
+		return PrimeIterator{};
+	}
+};
+
+/**
+ * \brief Primes in [from, to] as a vector
+ */
+std::vector<std::uint64_t> between(std::uint64_t from, std::uint64_t to);
+
+}
+
+#endif /* CODE_EXAMPLES_NUMBERS_PRIMES_H_ */
@@ -0,0 +1,54 @@
+/*
+ * primes_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "primes.h"
+#include "../concurrency/thread_pool.h"
+#include "../commands.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace bench_primes {
+
+// usage: bench_primes [limit] [max threads]
+// without a limit sieves up to 1e9 and 1e10, thread counts are 1, 2, 4, ... up to max threads
+int main(int argc, char** argv) {
+	std::vector<std::uint64_t> limits{1000000000ULL, 10000000000ULL};
+	if (argc > 1) {
+		limits = {std::strtoull(argv[1], nullptr, 10)};
+	}
+	int max_threads = argc > 2 ? std::atoi(argv[2]) : 0;
+	if (max_threads <= 0) {
+		max_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+	}
+
+	std::cout<<"limit\tthreads\tpi(limit)\tseconds"<<std::endl;
+	for (std::uint64_t limit: limits) {
+		for (int threads = 1; threads <= max_threads; threads *= 2) {
+			auto begin = std::chrono::steady_clock::now();
+			std::uint64_t count = 0;
+			if (threads == 1) {
+				count = primes::pi(limit);
+			} else {
+				ThreadPool pool{static_cast<std::size_t>(threads)};
+				count = primes::pi(limit, pool);
+			}
+			std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+			std::cout<<limit<<"\t"<<threads<<"\t"<<count<<"\t"<<elapsed.count()<<std::endl;
+		}
+	}
+	return 0;
+}
+
+static commands::Registrar registrar{"bench_primes", commands::Kind::benchmark, main,
+		"segmented wheel sieve: pi(1e9) and pi(1e10) by thread count", {"100000000", "2"}};
+
+}
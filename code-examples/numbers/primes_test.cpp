@@ -0,0 +1,59 @@
+/*
+ * primes_test.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "primes.h"
+#include "../concurrency/thread_pool.h"
+
+#include "../doctest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+TEST_CASE("[primes] - simple sieve") {
+	CHECK(primes::simple_sieve(1).empty());
+	CHECK(primes::simple_sieve(30) == std::vector<std::uint32_t>{2, 3, 5, 7, 11, 13, 17, 19, 23, 29});
+	CHECK(primes::simple_sieve(1000000).size() == 78498);
+}
+
+TEST_CASE("[primes] - pi matches the simple sieve") {
+	std::vector<std::uint32_t> reference = primes::simple_sieve(3000000);
+	// around the wheel, the presieve pattern (30030), segment boundaries (983040) and squares of sieving primes
+	for (std::uint64_t n: {0, 1, 2, 3, 4, 5, 6, 7, 29, 30, 31, 289, 30029, 30030, 30031, 983039, 983040, 983041, 2999999}) {
+		CAPTURE(n);
+		auto expected = std::upper_bound(reference.begin(), reference.end(), n) - reference.begin();
+		CHECK(primes::pi(n) == static_cast<std::uint64_t>(expected));
+	}
+	CHECK(primes::pi(100000000) == 5761455);
+}
+
+TEST_CASE("[primes] - parallel pi") {
+	ThreadPool pool{4};
+	CHECK(primes::pi(1, pool) == 0);
+	CHECK(primes::pi(1000, pool) == 168);
+	CHECK(primes::pi(10000000, pool) == 664579);
+	CHECK(primes::pi(100000000, pool) == primes::pi(100000000));
+}
+
+TEST_CASE("[primes] - iterating over a range") {
+	CHECK(primes::between(0, 30) == std::vector<std::uint64_t>{2, 3, 5, 7, 11, 13, 17, 19, 23, 29});
+	CHECK(primes::between(4, 4).empty());
+	CHECK(primes::between(10, 5).empty());
+	CHECK(primes::between(7, 7) == std::vector<std::uint64_t>{7});
+	CHECK(primes::between(1000000000, 1000000100) == std::vector<std::uint64_t>{1000000007, 1000000009, 1000000021,
+		1000000033, 1000000087, 1000000093, 1000000097});
+
+	std::vector<std::uint32_t> reference = primes::simple_sieve(2000000);
+	std::vector<std::uint64_t> all = primes::between(0, 2000000); // two segments
+	CHECK(std::equal(all.begin(), all.end(), reference.begin(), reference.end()));
+
+	primes::Range range{999000, 1001000};
+	auto first = range.begin();
+	CHECK(*first == 999007);
+	CHECK(*++first == 999023);
+	CHECK(std::distance(range.begin(), range.end()) == primes::pi(1001000) - primes::pi(999000));
+}
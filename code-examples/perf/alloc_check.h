@@ -0,0 +1,51 @@
+/*
+ * alloc_check.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_PERF_ALLOC_CHECK_H_
+#define CODE_EXAMPLES_PERF_ALLOC_CHECK_H_
+
+#include "alloc_counter.h"
+
+/**
+ * \brief Assertions on the number of heap allocations made by an expression
+ *
+ *     CHECK_ALLOCATIONS_LE(1, copy = original);
+ *     REQUIRE_NO_ALLOC(list[500]);
+ *
+ * Only the calling thread is counted (alloc_counter::this_thread()), so allocations of other threads
+ * (thread pools, other tests in doctest_shards workers) don't make the check fail.
+ * The macros use CHECK, REQUIRE and INFO, include this header after doctest.h or catch.hpp.
+ * The value of the expression is discarded inside the measured scope, destroying it is measured too.
+ */
+namespace alloc_counter {
+
+/**
+ * \brief Number of allocations made by the calling thread while calling function
+ */
+template<typename Function>
+long long allocations_in(Function&& function) {
+	AllocationStats before = this_thread();
+	function();
+	return (this_thread() - before).allocations;
+}
+
+}
+
+// the expression is variadic - commas in template arguments and function calls don't split it
+#define ALLOC_CHECK_IMPL(assertion, limit, ...) \
+	do { \
+		long long alloc_check_count = ::alloc_counter::allocations_in([&]() { (void)(__VA_ARGS__); }); \
+		INFO("allocations in " #__VA_ARGS__ ": " << alloc_check_count); \
+		assertion(alloc_check_count <= (limit)); \
+	} while (false)
+
+#define CHECK_ALLOCATIONS_LE(limit, ...) ALLOC_CHECK_IMPL(CHECK, limit, __VA_ARGS__)
+#define REQUIRE_ALLOCATIONS_LE(limit, ...) ALLOC_CHECK_IMPL(REQUIRE, limit, __VA_ARGS__)
+#define CHECK_NO_ALLOC(...) ALLOC_CHECK_IMPL(CHECK, 0, __VA_ARGS__)
+#define REQUIRE_NO_ALLOC(...) ALLOC_CHECK_IMPL(REQUIRE, 0, __VA_ARGS__)
+
+#endif /* CODE_EXAMPLES_PERF_ALLOC_CHECK_H_ */
@@ -0,0 +1,172 @@
+/*
+ * alloc_counter.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "alloc_counter.h"
+#include "../concurrency/sharded_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace alloc_counter {
+
+// constexpr constructors - ready before any allocation made by static initialization
+ShardedCounter<> allocations;
+ShardedCounter<> deallocations;
+ShardedCounter<> bytes;
+
+thread_local bool paused = false;
+thread_local AllocationStats thread_stats; // constant initialized, no TLS init calls from operator new
+
+AllocationStats total() {
+	return {allocations.load(), deallocations.load(), bytes.load()};
+}
+
+AllocationStats this_thread() {
+	return thread_stats;
+}
+
+PauseScope::PauseScope(): was_paused{paused} {
+	paused = true;
+}
+
+PauseScope::~PauseScope() {
+	paused = was_paused;
+}
+
+void count_allocation(std::size_t size) {
+	if (!paused) {
+		allocations.add();
+		bytes.add(static_cast<long long>(size));
+		thread_stats.allocations++;
+		thread_stats.bytes += static_cast<long long>(size);
+	}
+}
+
+void count_deallocation(void* ptr) {
+	if (ptr && !paused) {
+		deallocations.add();
+		thread_stats.deallocations++;
+	}
+}
+
+void* allocate(std::size_t size) {
+	if (size == 0) {
+		size = 1;
+	}
+	while (true) {
+		void* ptr = std::malloc(size);
+		if (ptr) {
+			count_allocation(size);
+			return ptr;
+		}
+		std::new_handler handler = std::get_new_handler();
+		if (!handler) {
+			throw std::bad_alloc{};
+		}
+		handler();
+	}
+}
+
+void* allocate_aligned(std::size_t size, std::align_val_t alignment) {
+	std::size_t align = static_cast<std::size_t>(alignment);
+	// aligned_alloc requires size to be a multiple of alignment
+	std::size_t rounded = (size + align - 1) / align * align;
+	if (rounded == 0) {
+		rounded = align;
+	}
+	while (true) {
+		void* ptr = std::aligned_alloc(align, rounded);
+		if (ptr) {
+			count_allocation(size);
+			return ptr;
+		}
+		std::new_handler handler = std::get_new_handler();
+		if (!handler) {
+			throw std::bad_alloc{};
+		}
+		handler();
+	}
+}
+
+void deallocate(void* ptr) {
+	count_deallocation(ptr);
+	std::free(ptr);
+}
+
+}
+
+void* operator new(std::size_t size) {
+	return alloc_counter::allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+	return alloc_counter::allocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+	try {
+		return alloc_counter::allocate(size);
+	} catch (const std::bad_alloc&) {
+		return nullptr;
+	}
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+	try {
+		return alloc_counter::allocate(size);
+	} catch (const std::bad_alloc&) {
+		return nullptr;
+	}
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+	return alloc_counter::allocate_aligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+	return alloc_counter::allocate_aligned(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept {
+	alloc_counter::deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+	alloc_counter::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+	alloc_counter::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+	alloc_counter::deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+	alloc_counter::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+	alloc_counter::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+	alloc_counter::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+	alloc_counter::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+	alloc_counter::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+	alloc_counter::deallocate(ptr);
+}
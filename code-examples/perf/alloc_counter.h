@@ -0,0 +1,61 @@
+/*
+ * alloc_counter.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_PERF_ALLOC_COUNTER_H_
+#define CODE_EXAMPLES_PERF_ALLOC_COUNTER_H_
+
+/**
+ * \brief Counting of heap allocations
+ *
+ * alloc_counter.cpp replaces the global operator new and operator delete (all forms),
+ * every call made while counting is not paused in the calling thread is counted.
+ */
+namespace alloc_counter {
+
+/**
+ * \brief Number of allocations, deallocations and allocated bytes
+ */
+struct AllocationStats {
+	long long allocations = 0;		/**< Number of calls to operator new (all forms) */
+	long long deallocations = 0;	/**< Number of calls to operator delete with non-null pointer */
+	long long bytes = 0;			/**< Total number of bytes requested from operator new */
+
+	AllocationStats operator-(const AllocationStats& other) const {
+		return {allocations - other.allocations, deallocations - other.deallocations, bytes - other.bytes};
+	}
+};
+
+/**
+ * \brief Counters of the whole process (all threads) since the start
+ */
+AllocationStats total();
+
+/**
+ * \brief Counters of the calling thread since its start
+ *
+ * Unlike differences of total(), not affected by allocations in other threads (see alloc_check.h).
+ */
+AllocationStats this_thread();
+
+/**
+ * \brief Pauses counting in the calling thread while in scope
+ *
+ * Used by measurement code to hide its own bookkeeping allocations. Scopes can be nested.
+ */
+class PauseScope {
+private:
+	bool was_paused;
+public:
+	PauseScope();
+	~PauseScope();
+	PauseScope(const PauseScope&) = delete;
+	PauseScope& operator=(const PauseScope&) = delete;
+};
+
+}
+
+#endif /* CODE_EXAMPLES_PERF_ALLOC_COUNTER_H_ */
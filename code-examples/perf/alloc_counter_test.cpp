@@ -0,0 +1,89 @@
+/*
+ * alloc_counter_test.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "alloc_counter.h"
+
+#include "../doctest.h"
+#include "alloc_check.h"
+
+#include <thread>
+#include <vector>
+
+TEST_CASE("[alloc counter] - new and delete are counted") {
+	auto before = alloc_counter::total();
+	int* volatile value = new int{5}; // volatile - so that the compiler can't remove new and delete
+	auto after_new = alloc_counter::total() - before;
+	CHECK(after_new.allocations == 1);
+	CHECK(after_new.bytes == sizeof(int));
+	CHECK(after_new.deallocations == 0);
+
+	delete value;
+	auto after_delete = alloc_counter::total() - before;
+	CHECK(after_delete.allocations == 1);
+	CHECK(after_delete.deallocations == 1);
+
+	SUBCASE("arrays") {
+		before = alloc_counter::total();
+		char* volatile buffer = new char[100];
+		auto diff = alloc_counter::total() - before;
+		CHECK(diff.allocations == 1);
+		CHECK(diff.bytes == 100);
+		delete[] buffer;
+		CHECK((alloc_counter::total() - before).deallocations == 1);
+	}
+	SUBCASE("deleting nullptr is not counted") {
+		before = alloc_counter::total();
+		int* empty = nullptr;
+		delete empty;
+		CHECK((alloc_counter::total() - before).deallocations == 0);
+	}
+}
+
+TEST_CASE("[alloc counter] - paused counting") {
+	auto before = alloc_counter::total();
+	{
+		alloc_counter::PauseScope pause;
+		{
+			alloc_counter::PauseScope nested;
+		}
+		std::vector<int> hidden(10); // still paused after the nested scope
+	}
+	CHECK((alloc_counter::total() - before).allocations == 0);
+
+	std::vector<int> counted(10);
+	CHECK((alloc_counter::total() - before).allocations == 1);
+}
+
+TEST_CASE("[alloc counter] - counts of the calling thread") {
+	auto before = alloc_counter::this_thread();
+	std::thread other{[]() {
+		std::vector<int> elsewhere(100);
+	}};
+	other.join();
+	// std::thread allocates its state in this thread, the vector of the other thread is not counted here
+	auto diff = alloc_counter::this_thread() - before;
+	CHECK(diff.bytes < static_cast<long long>(100 * sizeof(int)));
+
+	CHECK(alloc_counter::allocations_in([]() {
+		std::vector<int> two(10), three(10);
+	}) == 2);
+}
+
+TEST_CASE("[alloc counter] - allocation assertions") {
+	std::vector<int> values(10);
+	CHECK_NO_ALLOC(values[5] = 1);
+	CHECK_NO_ALLOC(values.resize(5));
+	CHECK_ALLOCATIONS_LE(1, values.push_back(2));
+	CHECK_ALLOCATIONS_LE(2, std::vector<int>(1), std::vector<int>(2)); // commas in the expression
+	REQUIRE_ALLOCATIONS_LE(100, values.shrink_to_fit());
+	REQUIRE_NO_ALLOC(values.clear());
+}
+
+TEST_CASE("[alloc counter] - allocation assertions fail on allocations" * doctest::should_fail()) {
+	CHECK_NO_ALLOC(std::vector<int>(10));
+	CHECK_ALLOCATIONS_LE(1, std::vector<int>(1), std::vector<int>(2));
+}
@@ -0,0 +1,120 @@
+/*
+ * assert_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "assert_bench.h"
+#include "../commands.h"
+
+#include "../doctest.h"
+#include "check_all.h"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+
+// build with -DDOCTEST_CONFIG_SUPER_FAST_ASSERTS to see its effect on the binary asserts (CHECK_GE)
+#ifdef DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+#define ASSERT_BENCH_MODE " (super fast)"
+#else
+#define ASSERT_BENCH_MODE ""
+#endif
+
+TEST_CASE("[assert bench] - doctest CHECK" * doctest::skip()) {
+	const std::vector<int>& values = bench_asserts::values();
+	bench_asserts::measure("doctest CHECK" ASSERT_BENCH_MODE, [&]() {
+		for (int value: values) {
+			CHECK(value >= 0);
+		}
+	});
+}
+
+TEST_CASE("[assert bench] - doctest CHECK_GE" * doctest::skip()) {
+	const std::vector<int>& values = bench_asserts::values();
+	bench_asserts::measure("doctest CHECK_GE" ASSERT_BENCH_MODE, [&]() {
+		for (int value: values) {
+			CHECK_GE(value, 0);
+		}
+	});
+}
+
+TEST_CASE("[assert bench] - doctest CHECK_ALL" * doctest::skip()) {
+	const std::vector<int>& values = bench_asserts::values();
+	bench_asserts::measure("doctest CHECK_ALL", [&]() {
+		CHECK_ALL(values, [](int value) { return value >= 0; });
+	});
+}
+
+namespace bench_asserts {
+
+namespace {
+
+std::size_t count = 1000; // small if the test cases are run with --no-skip
+
+struct Result {
+	std::string name;
+	double seconds;
+};
+
+std::vector<Result> results;
+
+}
+
+const std::vector<int>& values() {
+	static std::vector<int> values;
+	if (values.size() != count) {
+		values.resize(count);
+		std::iota(values.begin(), values.end(), 0);
+	}
+	return values;
+}
+
+void add_result(const std::string& name, double seconds) {
+	results.push_back({name, seconds});
+}
+
+int main(int argc, char** argv) {
+	count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+	results.clear();
+
+	const std::vector<int>& checked = values();
+	measure("loop without assertions", [&]() {
+		std::size_t failures = 0;
+		for (int value: checked) {
+			failures += !(value >= 0);
+		}
+		volatile std::size_t sink = failures;
+		(void)sink;
+	});
+
+	doctest::Context context;
+	context.addFilter("test-case", "[assert bench]*");
+	context.setOption("no-skip", true);
+	int failed = context.run();
+
+#ifdef CATCH_ENABLED
+	const commands::Command* catch_tests = commands::Registry::global().find("unit_catch");
+	if (catch_tests) {
+		char program[] = "unit_catch";
+		char tag[] = "[assert_bench]";
+		char* catch_argv[] = {program, tag, nullptr};
+		failed += catch_tests->entry(2, catch_argv);
+	}
+#endif
+
+	std::cout<<count<<" values checked by every loop"<<std::endl;
+	std::cout<<std::left<<std::setw(32)<<"assertions"<<std::right<<"\tseconds\tns per value"<<std::endl;
+	for (const Result& result: results) {
+		std::cout<<std::left<<std::setw(32)<<result.name<<std::right<<"\t"<<result.seconds
+				<<"\t"<<result.seconds * 1e9 / static_cast<double>(count ? count : 1)<<std::endl;
+	}
+	return failed ? 1 : 0;
+}
+
+static commands::Registrar registrar{"bench_asserts", commands::Kind::benchmark, main,
+		"assertion throughput of doctest and Catch2: CHECK per value and CHECK_ALL", {"200000"}};
+
+}
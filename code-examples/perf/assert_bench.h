@@ -0,0 +1,42 @@
+/*
+ * assert_bench.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_PERF_ASSERT_BENCH_H_
+#define CODE_EXAMPLES_PERF_ASSERT_BENCH_H_
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Cost of assertions in hot loops: doctest and Catch2 test cases check the same values,
+ * with an assertion per value or with one CHECK_ALL (see check_all.h)
+ *
+ * The test cases are skipped (doctest) or hidden (Catch2) in usual runs, bench_asserts::main runs them.
+ */
+namespace bench_asserts {
+
+/**
+ * \brief Values checked by the test cases: 0, 1, ... count - 1, count is set by main
+ */
+const std::vector<int>& values();
+
+/**
+ * \brief Called by the test cases with the time of their loop
+ */
+void add_result(const std::string& name, double seconds);
+
+template<typename Loop>
+void measure(const std::string& name, Loop&& loop) {
+	auto begin = std::chrono::steady_clock::now();
+	loop();
+	add_result(name, std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count());
+}
+
+}
+
+#endif /* CODE_EXAMPLES_PERF_ASSERT_BENCH_H_ */
@@ -0,0 +1,31 @@
+/*
+ * catch_assert_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifdef CATCH_ENABLED
+#include "assert_bench.h"
+
+#include "../catch.hpp"
+#include "check_all.h"
+
+// hidden ([.]) from usual runs, bench_asserts::main runs them with the other frameworks' loops
+
+TEST_CASE("Catch2 CHECK", "[.][assert_bench]") {
+	const std::vector<int>& values = bench_asserts::values();
+	bench_asserts::measure("Catch2 CHECK", [&]() {
+		for (int value: values) {
+			CHECK(value >= 0);
+		}
+	});
+}
+
+TEST_CASE("Catch2 CHECK_ALL", "[.][assert_bench]") {
+	const std::vector<int>& values = bench_asserts::values();
+	bench_asserts::measure("Catch2 CHECK_ALL", [&]() {
+		CHECK_ALL(values, [](int value) { return value >= 0; });
+	});
+}
+#endif
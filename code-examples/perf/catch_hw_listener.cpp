@@ -0,0 +1,41 @@
+/*
+ * catch_hw_listener.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifdef CATCH_ENABLED
+#include "hw_report.h"
+
+#define CATCH_CONFIG_EXTERNAL_INTERFACES // listener base classes
+#include "../catch.hpp"
+
+namespace hw_report {
+
+/**
+ * \brief Catch2 listener counting hardware events of each test case (see hw_report)
+ *
+ * Benchmarks run inside their test cases, so a benchmark's counts include all its samples and warmup.
+ */
+class CatchHwListener: public Catch::TestEventListenerBase {
+public:
+	using TestEventListenerBase::TestEventListenerBase;
+
+	void testCaseStarting(Catch::TestCaseInfo const& info) override {
+		hw_report::test_case_start(info.name, info.lineInfo.file, static_cast<unsigned>(info.lineInfo.line));
+	}
+
+	void testCaseEnded(Catch::TestCaseStats const& stats) override {
+		hw_report::test_case_end(stats.totals.assertions.failed > 0);
+	}
+
+	void testRunEnded(Catch::TestRunStats const&) override {
+		write();
+	}
+};
+
+CATCH_REGISTER_LISTENER(CatchHwListener)
+
+}
+#endif
@@ -0,0 +1,89 @@
+/*
+ * check_all.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_PERF_CHECK_ALL_H_
+#define CODE_EXAMPLES_PERF_CHECK_ALL_H_
+
+#include <cstddef>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \brief One assertion for a whole range: the predicate must hold for every element
+ *
+ *     CHECK_ALL(values, [](int value) { return value >= 0; });
+ *     REQUIRE_ALL(sums, [&](const Rational& sum) { return sum - b == a; });
+ *
+ * A CHECK per element in a loop of a million values spends most of the time in the framework
+ * (expression decomposition, result bookkeeping, reporters). Here the loop only calls the predicate,
+ * the framework sees a single CHECK(failures == 0) and the first failing elements (index and value,
+ * if it can be printed) are added with INFO. Compare the cost with "code-examples bench_asserts".
+ * The macros use CHECK, REQUIRE and INFO, include this header after doctest.h or catch.hpp.
+ */
+namespace check_all {
+
+constexpr std::size_t reported_failures = 8;	/**< Failing elements described in the message */
+
+template<typename T, typename = void>
+struct is_printable: std::false_type {};
+
+template<typename T>
+struct is_printable<T, std::void_t<decltype(std::declval<std::ostream&>()<<std::declval<const T&>())>>: std::true_type {};
+
+template<typename T>
+void print(std::ostream& out, const T& value) {
+	if constexpr (is_printable<T>::value) {
+		out<<value;
+	} else {
+		out<<"{?}";
+	}
+}
+
+/**
+ * \brief Applies predicate to every element of range, describes the first failing ones in description
+ * \return number of elements for which predicate returned false
+ */
+template<typename Range, typename Predicate>
+std::size_t failures(const Range& range, Predicate&& predicate, std::string& description) {
+	std::size_t index = 0;
+	std::size_t failed = 0;
+	for (const auto& element: range) {
+		if (!predicate(element)) {
+			if (failed < reported_failures) {
+				std::ostringstream out;
+				out<<(failed ? ", [" : "[")<<index<<"] = ";
+				print(out, element);
+				description += out.str();
+			}
+			failed++;
+		}
+		index++;
+	}
+	if (failed > reported_failures) {
+		description += ", ...";
+	}
+	return failed;
+}
+
+}
+
+// the predicate is variadic - commas in lambdas don't split it
+#define CHECK_ALL_IMPL(assertion, range, ...) \
+	do { \
+		std::string check_all_description; \
+		std::size_t check_all_failures = ::check_all::failures(range, __VA_ARGS__, check_all_description); \
+		INFO(#range " failed " #__VA_ARGS__ " for " << check_all_failures << " elements: " << check_all_description); \
+		assertion(check_all_failures == 0); \
+	} while (false)
+
+#define CHECK_ALL(range, ...) CHECK_ALL_IMPL(CHECK, range, __VA_ARGS__)
+#define REQUIRE_ALL(range, ...) CHECK_ALL_IMPL(REQUIRE, range, __VA_ARGS__)
+
+#endif /* CODE_EXAMPLES_PERF_CHECK_ALL_H_ */
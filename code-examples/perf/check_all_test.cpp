@@ -0,0 +1,48 @@
+/*
+ * check_all_test.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "../doctest.h"
+#include "check_all.h"
+
+#include <list>
+#include <string>
+#include <vector>
+
+TEST_CASE("[check all] - counts and describes failing elements") {
+	std::vector<int> values{1, -2, 3, -4};
+	std::string description;
+	CHECK(check_all::failures(values, [](int value) { return value > 0; }, description) == 2);
+	CHECK(description == "[1] = -2, [3] = -4");
+
+	description.clear();
+	CHECK(check_all::failures(values, [](int) { return true; }, description) == 0);
+	CHECK(description.empty());
+
+	SUBCASE("only the first failures are described") {
+		std::vector<int> negative(20, -1);
+		CHECK(check_all::failures(negative, [](int value) { return value > 0; }, description) == 20);
+		CHECK(description.find("[7] = -1") != std::string::npos);
+		CHECK(description.find("[8]") == std::string::npos);
+		CHECK(description.substr(description.size() - 5) == ", ...");
+	}
+
+	SUBCASE("values without operator<<") {
+		struct Opaque {};
+		std::list<Opaque> opaque(1);
+		CHECK(check_all::failures(opaque, [](const Opaque&) { return false; }, description) == 1);
+		CHECK(description == "[0] = {?}");
+	}
+}
+
+TEST_CASE("[check all] - one assertion for a range") {
+	std::vector<int> squares;
+	for (int i = 0; i < 1000; i++) {
+		squares.push_back(i * i);
+	}
+	CHECK_ALL(squares, [](int square) { return square >= 0; });
+	REQUIRE_ALL(squares, [&](const int& square) { return &square == &squares.front() || square > *(&square - 1); });
+}
@@ -0,0 +1,102 @@
+/*
+ * complexity.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "complexity.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace complexity {
+
+const char* name(Class complexity_class) {
+	switch (complexity_class) {
+	case Class::constant: return "O(1)";
+	case Class::logarithmic: return "O(log n)";
+	case Class::linear: return "O(n)";
+	case Class::linearithmic: return "O(n log n)";
+	default: return "unknown";
+	}
+}
+
+std::ostream& operator<<(std::ostream& out, Class complexity_class) {
+	return out<<name(complexity_class);
+}
+
+double model(Class complexity_class, double n) {
+	switch (complexity_class) {
+	case Class::constant: return 1;
+	case Class::logarithmic: return std::log2(n);
+	case Class::linear: return n;
+	case Class::linearithmic: return n * std::log2(n);
+	default: throw std::invalid_argument{"complexity class"};
+	}
+}
+
+namespace {
+
+/**
+ * \brief Weighted least squares of time = overhead + coefficient * f(n), weights 1 / time^2
+ */
+void fit_class(const std::vector<Sample>& samples, Class complexity_class, double& overhead, double& coefficient) {
+	double sw = 0, sf = 0, sff = 0, st = 0, sft = 0;
+	for (const Sample& sample: samples) {
+		double w = 1 / (sample.seconds * sample.seconds);
+		double f = model(complexity_class, static_cast<double>(sample.n));
+		sw += w;
+		sf += w * f;
+		sff += w * f * f;
+		st += w * sample.seconds;
+		sft += w * f * sample.seconds;
+	}
+	overhead = st / sw;
+	coefficient = 0;
+	if (complexity_class == Class::constant) {
+		return;
+	}
+	double determinant = sw * sff - sf * sf;
+	double a = (st * sff - sf * sft) / determinant;
+	double b = (sw * sft - sf * st) / determinant;
+	if (b <= 0) {
+		return; // decreasing: no better than constant
+	}
+	if (a < 0) {
+		overhead = 0;
+		coefficient = sft / sff;
+	} else {
+		overhead = a;
+		coefficient = b;
+	}
+}
+
+}
+
+Fit fit(const std::vector<Sample>& samples, double tolerance) {
+	if (samples.size() < 3) {
+		throw std::invalid_argument{"at least three samples are needed for a fit"};
+	}
+	Fit result;
+	for (int c = 0; c < static_cast<int>(Class::class_count); c++) {
+		Class complexity_class = static_cast<Class>(c);
+		double overhead, coefficient;
+		fit_class(samples, complexity_class, overhead, coefficient);
+		double error = 0;
+		for (const Sample& sample: samples) {
+			double predicted = overhead + coefficient * model(complexity_class, static_cast<double>(sample.n));
+			double residual = 1 - predicted / sample.seconds;
+			error += residual * residual;
+		}
+		result.rms[c] = std::sqrt(error / samples.size());
+		if (c == 0 || result.rms[c] < result.rms[static_cast<int>(result.best)] - tolerance) {
+			result.best = complexity_class;
+			result.overhead = overhead;
+			result.coefficient = coefficient;
+		}
+	}
+	return result;
+}
+
+}
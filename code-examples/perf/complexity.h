@@ -0,0 +1,128 @@
+/*
+ * complexity.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_PERF_COMPLEXITY_H_
+#define CODE_EXAMPLES_PERF_COMPLEXITY_H_
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+/**
+ * \brief Empirical complexity: time an operation over geometrically growing inputs and fit the curve
+ *
+ *     auto samples = complexity::measure({},
+ *         [](std::size_t n) { return make_list(n); },          // input of size n, not timed
+ *         [](auto& list, std::size_t n) { return list[n - 1]; }); // timed, the result is kept in a checksum
+ *     CHECK(complexity::fit(samples).best == complexity::Class::linear);
+ *
+ * Each size is timed in batches of calls long enough for the clock, the fastest of several batches is kept.
+ * Every class is fitted by least squares as time = overhead + coefficient * f(n), both non-negative, with errors
+ * relative to the measured times (so that the largest sizes don't decide alone). The overhead stands for the cost
+ * of the call itself, an allocation etc. A class with two parameters always fits at least as well as O(1),
+ * so a higher class is chosen only if its error is smaller by more than the tolerance.
+ * Sizes should stay within the caches: a cache miss per element looks like a higher complexity class.
+ * Fits of measured times are not reliable enough for every test run: complexity_test.cpp skips them,
+ * bench_complexity runs them.
+ */
+namespace complexity {
+
+enum class Class { constant, logarithmic, linear, linearithmic, class_count };
+
+const char* name(Class complexity_class);
+
+std::ostream& operator<<(std::ostream& out, Class complexity_class);
+
+/**
+ * \brief f(n) of the class: 1, log2(n), n, n*log2(n)
+ */
+double model(Class complexity_class, double n);
+
+/**
+ * \brief Time of one call of the operation on input of size n
+ */
+struct Sample {
+	std::size_t n;
+	double seconds;
+};
+
+struct Fit {
+	Class best = Class::constant;
+	double overhead = 0;							/**< seconds, constant part of the best class */
+	double coefficient = 0;							/**< seconds per unit of f(n) of the best class */
+	double rms[static_cast<int>(Class::class_count)] = {};	/**< RMS of relative errors, per class */
+};
+
+/**
+ * \param tolerance how much smaller (absolute, in relative RMS) the error of a higher class must be
+ * \throw std::invalid_argument with less than three samples
+ */
+Fit fit(const std::vector<Sample>& samples, double tolerance = 0.02);
+
+struct Options {
+	std::size_t min_size = 1 << 8;
+	std::size_t max_size = 1 << 16;
+	double factor = 2;					/**< Ratio of consecutive sizes */
+	int repetitions = 5;				/**< Batches per size, the fastest is used */
+	double min_batch_seconds = 0.0005;	/**< Calls per batch are doubled until a batch takes this long */
+};
+
+/**
+ * \brief Times operation(input, n) for input = setup(n) and n from min_size to max_size
+ *
+ * The operation may change the input (e.g. append to it), it should stay of size about n.
+ * Its result is added to a checksum, so that the call is not optimized away.
+ * The expected class should be asserted on sizes where the time is not dominated by call overhead.
+ */
+template<typename Setup, typename Operation>
+std::vector<Sample> measure(const Options& options, Setup setup, Operation operation) {
+	using clock = std::chrono::steady_clock;
+	std::vector<Sample> samples;
+	volatile long long sink = 0;
+	for (double size = static_cast<double>(options.min_size); size <= options.max_size; size *= options.factor) {
+		std::size_t n = static_cast<std::size_t>(size);
+		auto input = setup(n);
+		auto run_batch = [&](long long calls) {
+			long long checksum = 0;
+			auto begin = clock::now();
+			for (long long i = 0; i < calls; i++) {
+				checksum += static_cast<long long>(operation(input, n));
+#if defined(__GNUC__)
+				// the input might have changed: pure calls like list.size_naive() can't be hoisted out of the loop
+				asm volatile("" ::: "memory");
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+				// the next call starts when this one is done: short independent traversals would overlap otherwise
+				__builtin_ia32_lfence();
+#endif
+			}
+			double seconds = std::chrono::duration<double>(clock::now() - begin).count();
+			sink = sink + checksum;
+			return seconds;
+		};
+
+		long long calls = 1;
+		double seconds = run_batch(calls);
+		while (seconds < options.min_batch_seconds) {
+			calls *= 2;
+			seconds = run_batch(calls);
+		}
+		for (int i = 1; i < options.repetitions; i++) {
+			double repeated = run_batch(calls);
+			if (repeated < seconds) {
+				seconds = repeated;
+			}
+		}
+		samples.push_back({n, seconds / calls});
+	}
+	return samples;
+}
+
+}
+
+#endif /* CODE_EXAMPLES_PERF_COMPLEXITY_H_ */
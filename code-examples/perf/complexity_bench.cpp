@@ -0,0 +1,27 @@
+/*
+ * complexity_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "../commands.h"
+
+#include "../doctest.h"
+
+namespace bench_complexity {
+
+// usage: bench_complexity [doctest options]
+// the wall-clock complexity test cases (skipped in test runs), a failure prints the measured times and fits
+int main(int argc, char** argv) {
+	doctest::Context context;
+	context.applyCommandLine(argc, argv);
+	context.addFilter("test-case", "[complexity]*");
+	context.setOption("no-skip", true);
+	return context.run() ? 1 : 0;
+}
+
+static commands::Registrar registrar{"bench_complexity", commands::Kind::benchmark, main,
+		"classes of list, string and GCD operations fitted from measured times"};
+
+}
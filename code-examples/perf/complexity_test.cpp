@@ -0,0 +1,175 @@
+/*
+ * complexity_test.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "complexity.h"
+#include "../lab_k29_11_09_20.h"
+#include "../list/list.h"
+#include "../rational.h"
+
+#include "../doctest.h"
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+std::vector<complexity::Sample> synthetic(double (*time)(double)) {
+	std::vector<complexity::Sample> samples;
+	for (std::size_t n = 16; n <= 65536; n *= 2) {
+		samples.push_back({n, time(static_cast<double>(n))});
+	}
+	return samples;
+}
+
+// DoublyLinkedList has only the implicit (shallow) copy, the list is built in place
+std::unique_ptr<DoublyLinkedList<int>> make_list(std::size_t n) {
+	auto list = std::make_unique<DoublyLinkedList<int>>();
+	for (std::size_t i = 0; i < n; i++) {
+		list->append(static_cast<int>(i));
+	}
+	return list;
+}
+
+using ListPointer = std::unique_ptr<DoublyLinkedList<int>>;
+
+std::string describe(const std::vector<complexity::Sample>& samples, const complexity::Fit& fit) {
+	std::string text;
+	for (const complexity::Sample& sample: samples) {
+		text += std::to_string(sample.n) + ": " + std::to_string(sample.seconds * 1e9) + " ns, ";
+	}
+	for (int c = 0; c < static_cast<int>(complexity::Class::class_count); c++) {
+		text += std::string{complexity::name(static_cast<complexity::Class>(c))} + " rms " + std::to_string(fit.rms[c]) + ", ";
+	}
+	return text;
+}
+
+}
+
+TEST_CASE("[complexity] - fit of synthetic curves") {
+	CHECK(complexity::fit(synthetic([](double) { return 5e-9; })).best == complexity::Class::constant);
+	CHECK(complexity::fit(synthetic([](double n) { return 2e-9 * std::log2(n); })).best == complexity::Class::logarithmic);
+	CHECK(complexity::fit(synthetic([](double n) { return 1e-9 * n; })).best == complexity::Class::linear);
+	CHECK(complexity::fit(synthetic([](double n) { return 1e-9 * n * std::log2(n); })).best == complexity::Class::linearithmic);
+
+	complexity::Fit linear = complexity::fit(synthetic([](double n) { return 3e-9 * n; }));
+	CHECK(linear.coefficient == doctest::Approx(3e-9));
+	CHECK(linear.rms[static_cast<int>(complexity::Class::linear)] == doctest::Approx(0).epsilon(1e-9));
+
+	// 10% noise doesn't change the class
+	complexity::Fit noisy = complexity::fit(synthetic([](double n) {
+		return 1e-9 * n * (static_cast<long long>(n) % 3 == 0 ? 1.1 : 0.9);
+	}));
+	CHECK(noisy.best == complexity::Class::linear);
+
+	// overhead of the call
+	complexity::Fit with_overhead = complexity::fit(synthetic([](double n) { return 100e-9 + 1e-9 * n; }));
+	CHECK(with_overhead.best == complexity::Class::linear);
+	CHECK(with_overhead.overhead == doctest::Approx(100e-9));
+	CHECK(with_overhead.coefficient == doctest::Approx(1e-9));
+
+	CHECK_THROWS_AS(complexity::fit({{10, 1.0}, {20, 2.0}}), std::invalid_argument);
+	CHECK(std::string{complexity::name(complexity::Class::linearithmic)} == "O(n log n)");
+}
+
+// The classes of real operations depend on wall-clock times, which timer noise and other processes can bend
+// on the small sizes that stay in the L1 cache: they are skipped in test runs, bench_complexity runs them
+
+TEST_CASE("[complexity] - DoublyLinkedList operations" * doctest::skip()) {
+	complexity::Options options;
+	// a traversal is a chain of dependent loads, its time per node grows with every cache level it leaves:
+	// up to 512 nodes (16 KB with the allocator overhead) the list stays in the L1 cache
+	options.min_size = 1 << 4;
+	options.max_size = 1 << 9;
+	options.repetitions = 15;
+	// constant time operations touch the ends of the list only: a wider range separates O(1) from O(log n),
+	// and calls of about 10 ns jump by a nanosecond or two between sizes, so a higher class must be clearly better
+	complexity::Options constant_options = options;
+	constant_options.max_size = 1 << 16;
+	const double constant_tolerance = 0.1;
+
+	SUBCASE("append is O(1)") {
+		// pop_front keeps the size
+		auto samples = complexity::measure(constant_options, make_list, [](ListPointer& list, std::size_t) {
+			list->append(1);
+			return list->pop_front();
+		});
+		complexity::Fit fit = complexity::fit(samples, constant_tolerance);
+		INFO(describe(samples, fit));
+		CHECK(fit.best == complexity::Class::constant);
+	}
+	SUBCASE("size is O(1), size_naive is O(n)") {
+		auto samples = complexity::measure(constant_options, make_list, [](ListPointer& list, std::size_t) {
+			return list->size();
+		});
+		complexity::Fit fit = complexity::fit(samples, constant_tolerance);
+		INFO(describe(samples, fit));
+		CHECK(fit.best == complexity::Class::constant);
+
+		auto naive_samples = complexity::measure(options, make_list, [](ListPointer& list, std::size_t) {
+			return list->size_naive();
+		});
+		complexity::Fit naive_fit = complexity::fit(naive_samples);
+		INFO(describe(naive_samples, naive_fit));
+		CHECK(naive_fit.best == complexity::Class::linear);
+	}
+	SUBCASE("operator[] of the last element is O(n)") {
+		auto samples = complexity::measure(options, make_list, [](ListPointer& list, std::size_t n) {
+			return (*list)[n - 1];
+		});
+		complexity::Fit fit = complexity::fit(samples);
+		INFO(describe(samples, fit));
+		CHECK(fit.best == complexity::Class::linear);
+	}
+}
+
+TEST_CASE("[complexity] - string copy is O(n)" * doctest::skip()) {
+	using lab_k29_11_09_20::string;
+	std::streambuf* buffer = std::cout.rdbuf(nullptr); // the copy constructor prints the copied string
+	complexity::Options options;
+	// the copy reads the original twice (strlen, memcpy), with both strings in the L1 cache up to 16 KB
+	options.min_size = 1 << 11;
+	options.max_size = 1 << 14;
+	options.factor = 1.41;
+	auto samples = complexity::measure(options, [](std::size_t n) {
+		return string{std::string(n, 'x').c_str()};
+	}, [](string& original, std::size_t) {
+		string copy{original};
+		return 1;
+	});
+	std::cout.rdbuf(buffer);
+	std::cout.clear();
+
+	complexity::Fit fit = complexity::fit(samples);
+	INFO(describe(samples, fit));
+	CHECK(fit.best == complexity::Class::linear);
+}
+
+TEST_CASE("[complexity] - Rational::GCD is O(log n)" * doctest::skip()) {
+	// consecutive Fibonacci numbers not larger than n - the largest number of steps
+	auto fibonacci_pair = [](std::size_t n) {
+		std::pair<int, int> pair{1, 1};
+		while (static_cast<std::size_t>(pair.first) + pair.second <= n) {
+			pair = {pair.first + pair.second, pair.first};
+		}
+		return pair;
+	};
+	complexity::Options options;
+	options.min_size = 1 << 4;
+	options.max_size = 1 << 30;
+	options.factor = 4;
+	auto samples = complexity::measure(options, fibonacci_pair, [](std::pair<int, int>& pair, std::size_t) {
+		return Rational::GCD(pair.first, pair.second);
+	});
+	complexity::Fit fit = complexity::fit(samples);
+	INFO(describe(samples, fit));
+	CHECK(fit.best == complexity::Class::logarithmic);
+}
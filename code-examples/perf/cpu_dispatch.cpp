@@ -0,0 +1,131 @@
+/*
+ * cpu_dispatch.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "cpu_dispatch.h"
+
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace cpu_dispatch {
+
+namespace {
+
+const char* option_prefix = "--isa=";
+
+std::mutex kernels_mutex;
+
+std::vector<KernelBase*>& kernels() {
+	static std::vector<KernelBase*> kernels;
+	return kernels;
+}
+
+std::atomic<bool> forced{false};
+std::atomic<Isa> forced_isa{Isa::baseline};
+
+bool detect(Isa isa) {
+#ifdef CPU_DISPATCH_X86
+	__builtin_cpu_init();
+	switch (isa) {
+	case Isa::avx2:
+		return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi") && __builtin_cpu_supports("bmi2")
+				&& __builtin_cpu_supports("popcnt");
+	case Isa::avx512:
+		return detect(Isa::avx2) && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")
+				&& __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512cd");
+	default:
+		return true;
+	}
+#else
+	return isa == Isa::baseline;
+#endif
+}
+
+void reset_kernels() {
+	std::lock_guard<std::mutex> lock{kernels_mutex};
+	for (KernelBase* kernel: kernels()) {
+		kernel->reset();
+	}
+}
+
+}
+
+const char* name(Isa isa) {
+	switch (isa) {
+	case Isa::avx2: return "avx2";
+	case Isa::avx512: return "avx512";
+	default: return "baseline";
+	}
+}
+
+Isa parse(const std::string& name) {
+	for (Isa isa: {Isa::baseline, Isa::avx2, Isa::avx512}) {
+		if (name == cpu_dispatch::name(isa)) {
+			return isa;
+		}
+	}
+	throw std::invalid_argument("unknown instruction set " + name + " (baseline, avx2, avx512)");
+}
+
+bool supported(Isa isa) {
+	static const bool supported[isa_count] = {detect(Isa::baseline), detect(Isa::avx2), detect(Isa::avx512)};
+	return supported[static_cast<std::size_t>(isa)];
+}
+
+Isa best() {
+	return supported(Isa::avx512) ? Isa::avx512 : supported(Isa::avx2) ? Isa::avx2 : Isa::baseline;
+}
+
+Isa active() {
+	return forced.load(std::memory_order_acquire) ? forced_isa.load(std::memory_order_relaxed) : best();
+}
+
+void force(Isa isa) {
+	if (!supported(isa)) {
+		throw std::invalid_argument(std::string{"this CPU doesn't support "} + name(isa));
+	}
+	forced_isa.store(isa, std::memory_order_relaxed);
+	forced.store(true, std::memory_order_release);
+	reset_kernels();
+}
+
+void unforce() {
+	forced.store(false, std::memory_order_release);
+	reset_kernels();
+}
+
+bool is_option(const char* argument) {
+	return std::strncmp(argument, option_prefix, std::strlen(option_prefix)) == 0;
+}
+
+void apply_command_line(int argc, char** argv) {
+	for (int i = 1; i < argc; i++) {
+		if (is_option(argv[i])) {
+			force(parse(argv[i] + std::strlen(option_prefix)));
+		}
+	}
+}
+
+ForceScope::ForceScope(Isa isa): was_forced{forced.load()}, previous{forced_isa.load()} {
+	force(isa);
+}
+
+ForceScope::~ForceScope() {
+	if (was_forced) {
+		force(previous);
+	} else {
+		unforce();
+	}
+}
+
+KernelBase::KernelBase() {
+	std::lock_guard<std::mutex> lock{kernels_mutex};
+	kernels().push_back(this);
+}
+
+}
@@ -0,0 +1,173 @@
+/*
+ * cpu_dispatch.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_PERF_CPU_DISPATCH_H_
+#define CODE_EXAMPLES_PERF_CPU_DISPATCH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CPU_DISPATCH_X86 1
+/** Implementations for Isa::avx2, in files compiled for baseline x86-64 */
+#define CPU_DISPATCH_AVX2 __attribute__((target("avx2,bmi,bmi2,popcnt")))
+/** Implementations for Isa::avx512 */
+#define CPU_DISPATCH_AVX512 __attribute__((target("avx2,bmi,bmi2,popcnt,avx512f,avx512bw,avx512vl,avx512cd")))
+#endif
+
+/**
+ * \brief Kernels with implementations for several instruction sets, the best one the CPU has is chosen at run time
+ *
+ *     static cpu_dispatch::Kernel<void(const int*, int*, std::size_t)> kernel{square_baseline, square_avx2, square_avx512};
+ *     kernel(values, squares, count);
+ *
+ * The implementations are functions with target attributes (CPU_DISPATCH_AVX2, CPU_DISPATCH_AVX512),
+ * so the program is built for baseline x86-64 and the vector instructions only run on CPUs which have them
+ * (__builtin_cpu_supports, which also checks that the OS saves the registers). Like an ifunc, a Kernel
+ * resolves on its first call and then calls through a pointer; unlike an ifunc (resolved by the dynamic
+ * loader once for the process) the choice can be forced, to test and measure every path on one machine:
+ * force() in code, "--isa=avx2" on the command line of unit_doctest and unit_catch.
+ */
+namespace cpu_dispatch {
+
+enum class Isa {
+	baseline,	/**< x86-64 (SSE2) or plain C++ on other architectures */
+	avx2,		/**< AVX2, BMI1, BMI2, POPCNT (Haswell) */
+	avx512		/**< AVX-512 F, BW, VL, CD (Skylake-SP) */
+};
+
+constexpr std::size_t isa_count = 3;
+
+/**
+ * \brief "baseline", "avx2", "avx512"
+ */
+const char* name(Isa isa);
+
+/**
+ * \throw std::invalid_argument for an unknown name
+ */
+Isa parse(const std::string& name);
+
+bool supported(Isa isa);
+
+/**
+ * \brief The highest supported Isa
+ */
+Isa best();
+
+/**
+ * \brief The forced Isa or best()
+ */
+Isa active();
+
+/**
+ * \brief Makes kernels use isa (or their highest implementation below it) from their next call
+ *
+ * Not meant to be called while other threads use kernels: they may still run the previous choice.
+ * \throw std::invalid_argument if the CPU doesn't support isa
+ */
+void force(Isa isa);
+
+/**
+ * \brief Back to best()
+ */
+void unforce();
+
+/**
+ * \brief Takes "--isa=<name>" from command line arguments (if present) and forces it
+ * \throw std::invalid_argument for an unknown or unsupported name
+ */
+void apply_command_line(int argc, char** argv);
+
+/**
+ * \brief true for the argument handled by apply_command_line() - for runners which reject unknown options (Catch2)
+ */
+bool is_option(const char* argument);
+
+/**
+ * \brief Forces an Isa while in scope, restores the previous choice after
+ */
+class ForceScope {
+private:
+	bool was_forced;
+	Isa previous;
+public:
+	explicit ForceScope(Isa isa);
+	~ForceScope();
+	ForceScope(const ForceScope&) = delete;
+	ForceScope& operator=(const ForceScope&) = delete;
+};
+
+/**
+ * \brief Kernels register themselves, so that force() can make them resolve again
+ */
+class KernelBase {
+protected:
+	KernelBase();
+	~KernelBase() = default;
+public:
+	virtual void reset() = 0;
+};
+
+template<typename Signature>
+class Kernel;
+
+/**
+ * \brief Implementations of one function for Isa::baseline, avx2 and avx512
+ *
+ * Kernels must be static objects (they stay registered until the program ends).
+ */
+template<typename Result, typename... Arguments>
+class Kernel<Result(Arguments...)>: public KernelBase {
+public:
+	using Function = Result (*)(Arguments...);
+private:
+	Function implementations[isa_count];
+	std::atomic<Function> resolved{nullptr};
+public:
+	/**
+	 * \param avx2, avx512 nullptr if there is no implementation, the next lower one is used
+	 */
+	Kernel(Function baseline, Function avx2, Function avx512): implementations{baseline, avx2, avx512} {}
+
+	/**
+	 * \brief Implementation used for isa: its own or the highest one below it (for benchmarks of every path)
+	 */
+	Function get(Isa isa) const {
+		for (std::size_t i = static_cast<std::size_t>(isa); i > 0; i--) {
+			if (implementations[i]) {
+				return implementations[i];
+			}
+		}
+		return implementations[0];
+	}
+
+	/**
+	 * \brief Implementation of active()
+	 */
+	Function resolve() {
+		Function function = resolved.load(std::memory_order_acquire);
+		if (!function) {
+			function = get(active());
+			resolved.store(function, std::memory_order_release);
+		}
+		return function;
+	}
+
+	Result operator()(Arguments... arguments) {
+		return resolve()(arguments...);
+	}
+
+	void reset() override {
+		resolved.store(nullptr, std::memory_order_release);
+	}
+};
+
+}
+
+#endif /* CODE_EXAMPLES_PERF_CPU_DISPATCH_H_ */
@@ -0,0 +1,78 @@
+/*
+ * cpu_dispatch_test.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "../doctest.h"
+#include "cpu_dispatch.h"
+
+#include <stdexcept>
+
+namespace {
+
+int from_baseline() {
+	return 0;
+}
+
+int from_avx2() {
+	return 2;
+}
+
+int from_avx512() {
+	return 512;
+}
+
+}
+
+TEST_CASE("[cpu dispatch] - names") {
+	for (cpu_dispatch::Isa isa: {cpu_dispatch::Isa::baseline, cpu_dispatch::Isa::avx2, cpu_dispatch::Isa::avx512}) {
+		CHECK(cpu_dispatch::parse(cpu_dispatch::name(isa)) == isa);
+	}
+	CHECK_THROWS_AS(cpu_dispatch::parse("sse9"), std::invalid_argument);
+
+	CHECK(cpu_dispatch::is_option("--isa=avx2"));
+	CHECK_FALSE(cpu_dispatch::is_option("--hw-report=out.json"));
+}
+
+TEST_CASE("[cpu dispatch] - supported levels") {
+	CHECK(cpu_dispatch::supported(cpu_dispatch::Isa::baseline));
+	if (cpu_dispatch::supported(cpu_dispatch::Isa::avx512)) {
+		CHECK(cpu_dispatch::supported(cpu_dispatch::Isa::avx2));
+	}
+	CHECK(cpu_dispatch::supported(cpu_dispatch::best()));
+	CHECK(cpu_dispatch::supported(cpu_dispatch::active()));
+	for (cpu_dispatch::Isa isa: {cpu_dispatch::Isa::avx2, cpu_dispatch::Isa::avx512}) {
+		if (!cpu_dispatch::supported(isa)) {
+			CHECK_THROWS_AS(cpu_dispatch::force(isa), std::invalid_argument);
+		}
+	}
+}
+
+TEST_CASE("[cpu dispatch] - kernels resolve once and again after force") {
+	static cpu_dispatch::Kernel<int()> kernel{from_baseline, from_avx2, from_avx512};
+	static cpu_dispatch::Kernel<int()> without_avx2{from_baseline, nullptr, from_avx512};
+	static cpu_dispatch::Kernel<int()> only_avx2{from_baseline, from_avx2, nullptr};
+
+	CHECK(kernel.get(cpu_dispatch::Isa::baseline) == from_baseline);
+	CHECK(without_avx2.get(cpu_dispatch::Isa::avx2) == from_baseline);
+	CHECK(only_avx2.get(cpu_dispatch::Isa::avx512) == from_avx2);
+
+	for (cpu_dispatch::Isa isa: {cpu_dispatch::Isa::baseline, cpu_dispatch::Isa::avx2, cpu_dispatch::Isa::avx512}) {
+		if (!cpu_dispatch::supported(isa)) {
+			continue;
+		}
+		CAPTURE(cpu_dispatch::name(isa));
+		cpu_dispatch::Isa before = cpu_dispatch::active();
+		{
+			cpu_dispatch::ForceScope scope{isa};
+			CHECK(cpu_dispatch::active() == isa);
+			CHECK(kernel() == kernel.get(isa)());
+			CHECK(kernel.resolve() == kernel.get(isa));
+			CHECK(only_avx2() == only_avx2.get(isa)());
+		}
+		CHECK(cpu_dispatch::active() == before);
+		CHECK(kernel.resolve() == kernel.get(before));
+	}
+}
@@ -0,0 +1,186 @@
+/*
+ * dispatch_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "cpu_dispatch.h"
+#include "../commands.h"
+#include "../lab_k29_11_09_20.h"
+#include "../lab_k29_25_09_20_templates/func.h"
+#include "../rational.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace bench_dispatch {
+
+template<typename Function>
+double seconds(Function function) {
+	auto begin = std::chrono::steady_clock::now();
+	function();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+void report(const std::string& what, const char* path, double seconds, std::size_t elements) {
+	std::cout<<what<<"\t"<<path<<"\t"<<seconds * 1e9 / static_cast<double>(elements)<<std::endl;
+}
+
+// usage: bench_dispatch [elements]
+// every kernel on every instruction set the CPU supports (default 1000000 elements, in cache from about 10000),
+// ns per element; the "scalar" rows are the per-element alternatives: square(T), square_sat(T), square_q(T),
+// std::strlen, GCD(int, int)
+int main(int argc, char** argv) {
+	std::size_t elements = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+	elements = std::max<std::size_t>(elements, 1);
+	const std::size_t repetitions = std::max<std::size_t>(1, (std::size_t{1} << 25) / elements);
+	const std::size_t gcd_repetitions = std::max<std::size_t>(1, repetitions / 32);
+
+	std::mt19937 random{20261018};
+	std::uniform_int_distribution<int> any{-46340, 46340};
+	std::vector<int> values(elements), b(elements), results(elements);
+	std::vector<double> real_values(elements), real_results(elements);
+	for (std::size_t i = 0; i < elements; i++) {
+		values[i] = any(random);
+		b[i] = any(random);
+		real_values[i] = values[i] * 0.25;
+	}
+	std::vector<std::int8_t> bytes(elements), byte_results(elements);
+	std::vector<std::int16_t> words(elements), word_results(elements);
+	for (std::size_t i = 0; i < elements; i++) {
+		bytes[i] = static_cast<std::int8_t>(random());
+		words[i] = static_cast<std::int16_t>(random());
+	}
+	std::string text(elements, 'a');
+	for (std::size_t i = 0; i < elements; i += 7) {
+		text[i] = 'b';
+	}
+	std::size_t checksum = 0;
+
+	std::cout<<"best: "<<cpu_dispatch::name(cpu_dispatch::best())<<std::endl;
+	std::cout<<"what\tpath\tns per element"<<std::endl;
+
+	for (cpu_dispatch::Isa isa: {cpu_dispatch::Isa::baseline, cpu_dispatch::Isa::avx2, cpu_dispatch::Isa::avx512}) {
+		if (!cpu_dispatch::supported(isa)) {
+			std::cout<<cpu_dispatch::name(isa)<<": not supported"<<std::endl;
+			continue;
+		}
+		cpu_dispatch::ForceScope scope{isa};
+		report("square int", cpu_dispatch::name(isa), seconds([&]() {
+			for (std::size_t r = 0; r < repetitions; r++) {
+				square(values.data(), results.data(), elements);
+				checksum += results[r % elements];
+			}
+		}), repetitions * elements);
+		report("square double", cpu_dispatch::name(isa), seconds([&]() {
+			for (std::size_t r = 0; r < repetitions; r++) {
+				square(real_values.data(), real_results.data(), elements);
+				checksum += real_results[r % elements] > 0;
+			}
+		}), repetitions * elements);
+		report("square_sat int8", cpu_dispatch::name(isa), seconds([&]() {
+			for (std::size_t r = 0; r < repetitions; r++) {
+				square_sat(bytes.data(), byte_results.data(), elements);
+				checksum += byte_results[r % elements];
+			}
+		}), repetitions * elements);
+		report("square_q Q15", cpu_dispatch::name(isa), seconds([&]() {
+			for (std::size_t r = 0; r < repetitions; r++) {
+				square_q<std::int16_t, 15>(words.data(), word_results.data(), elements);
+				checksum += word_results[r % elements];
+			}
+		}), repetitions * elements);
+		report("square_q Q31", cpu_dispatch::name(isa), seconds([&]() {
+			for (std::size_t r = 0; r < repetitions; r++) {
+				square_q<std::int32_t, 31>(values.data(), results.data(), elements);
+				checksum += results[r % elements];
+			}
+		}), repetitions * elements);
+		report("string length", cpu_dispatch::name(isa), seconds([&]() {
+			for (std::size_t r = 0; r < repetitions; r++) {
+				checksum += lab_k29_11_09_20::length(text.c_str() + r % 64);
+			}
+		}), repetitions * elements);
+		report("string count", cpu_dispatch::name(isa), seconds([&]() {
+			for (std::size_t r = 0; r < repetitions; r++) {
+				checksum += lab_k29_11_09_20::count(text.c_str() + r % 64, 'b');
+			}
+		}), repetitions * elements);
+		report("GCD", cpu_dispatch::name(isa), seconds([&]() {
+			for (std::size_t r = 0; r < gcd_repetitions; r++) {
+				Rational::GCD(values.data(), b.data(), results.data(), elements);
+				checksum += results[r % elements];
+			}
+		}), gcd_repetitions * elements);
+	}
+
+	report("square int", "scalar", seconds([&]() {
+		for (std::size_t r = 0; r < repetitions; r++) {
+			for (std::size_t i = 0; i < elements; i++) {
+				results[i] = square(values[i]);
+			}
+			checksum += results[r % elements];
+		}
+	}), repetitions * elements);
+	report("square double", "scalar", seconds([&]() {
+		for (std::size_t r = 0; r < repetitions; r++) {
+			for (std::size_t i = 0; i < elements; i++) {
+				real_results[i] = square(real_values[i]);
+			}
+			checksum += real_results[r % elements] > 0;
+		}
+	}), repetitions * elements);
+	report("square_sat int8", "scalar", seconds([&]() {
+		for (std::size_t r = 0; r < repetitions; r++) {
+			for (std::size_t i = 0; i < elements; i++) {
+				byte_results[i] = square_sat(bytes[i]);
+			}
+			checksum += byte_results[r % elements];
+		}
+	}), repetitions * elements);
+	report("square_q Q15", "scalar", seconds([&]() {
+		for (std::size_t r = 0; r < repetitions; r++) {
+			for (std::size_t i = 0; i < elements; i++) {
+				word_results[i] = square_q<std::int16_t, 15>(words[i]);
+			}
+			checksum += word_results[r % elements];
+		}
+	}), repetitions * elements);
+	report("square_q Q31", "scalar", seconds([&]() {
+		for (std::size_t r = 0; r < repetitions; r++) {
+			for (std::size_t i = 0; i < elements; i++) {
+				results[i] = square_q<std::int32_t, 31>(values[i]);
+			}
+			checksum += results[r % elements];
+		}
+	}), repetitions * elements);
+	report("string length", "strlen", seconds([&]() {
+		for (std::size_t r = 0; r < repetitions; r++) {
+			checksum += std::strlen(text.c_str() + r % 64);
+		}
+	}), repetitions * elements);
+	report("GCD", "scalar", seconds([&]() {
+		for (std::size_t r = 0; r < gcd_repetitions; r++) {
+			for (std::size_t i = 0; i < elements; i++) {
+				results[i] = Rational::GCD(values[i], b[i]);
+			}
+			checksum += results[r % elements];
+		}
+	}), gcd_repetitions * elements);
+
+	std::cout<<"checksum "<<checksum<<std::endl;
+	return 0;
+}
+
+static commands::Registrar registrar{"bench_dispatch", commands::Kind::benchmark, main,
+		"SIMD kernels (square, saturating and fixed-point squares, string scans, GCD) on every supported instruction set", {"100000"}};
+
+}
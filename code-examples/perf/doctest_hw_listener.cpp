@@ -0,0 +1,54 @@
+/*
+ * doctest_hw_listener.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "hw_report.h"
+
+#include "../doctest.h"
+
+namespace hw_report {
+
+/**
+ * \brief Doctest listener counting hardware events of each test case (see hw_report)
+ */
+class HwListener: public doctest::IReporter {
+public:
+	HwListener(const doctest::ContextOptions&) {}
+
+	void report_query(const doctest::QueryData&) override {}
+
+	void test_run_start() override {}
+
+	void test_run_end(const doctest::TestRunStats&) override {
+		write();
+	}
+
+	void test_case_start(const doctest::TestCaseData& test_case) override {
+		hw_report::test_case_start(test_case.m_name, test_case.m_file.c_str(), test_case.m_line);
+	}
+
+	void test_case_reenter(const doctest::TestCaseData&) override {}
+
+	void test_case_end(const doctest::CurrentTestCaseStats& stats) override {
+		hw_report::test_case_end(stats.failure_flags != 0);
+	}
+
+	void test_case_exception(const doctest::TestCaseException&) override {}
+
+	void subcase_start(const doctest::SubcaseSignature&) override {}
+
+	void subcase_end() override {}
+
+	void log_assert(const doctest::AssertData&) override {}
+
+	void log_message(const doctest::MessageData&) override {}
+
+	void test_case_skipped(const doctest::TestCaseData&) override {}
+};
+
+}
+
+DOCTEST_REGISTER_LISTENER("hw", 3, hw_report::HwListener);
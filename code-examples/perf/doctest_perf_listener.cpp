@@ -0,0 +1,262 @@
+/*
+ * doctest_perf_listener.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "doctest_perf_listener.h"
+#include "alloc_counter.h"
+#include "json.h"
+
+#include "../doctest.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+namespace perf_report {
+
+std::string output_path;
+
+void set_output(const std::string& path) {
+	output_path = path;
+}
+
+void apply_command_line(int argc, char** argv) {
+	const char* prefix = "--perf-report=";
+	const std::size_t prefix_length = std::strlen(prefix);
+	for (int i = 1; i < argc; i++) {
+		if (std::strncmp(argv[i], prefix, prefix_length) == 0) {
+			set_output(argv[i] + prefix_length);
+		}
+	}
+}
+
+const std::string& output() {
+	return output_path;
+}
+
+bool merge(const std::vector<std::string>& inputs, const std::string& path) {
+	std::ofstream out{path};
+	if (!out) {
+		return false;
+	}
+	out<<"{\n\"test_cases\": [";
+	bool first = true;
+	for (const std::string& input: inputs) {
+		std::ifstream in{input};
+		if (!in) {
+			continue;
+		}
+		std::stringstream buffer;
+		buffer<<in.rdbuf();
+		in.close();
+		std::remove(input.c_str());
+
+		// reports are written by write_report below: records are between the first '[' and the last ']'
+		std::string report = buffer.str();
+		std::size_t begin = report.find('[');
+		std::size_t end = report.rfind(']');
+		if (begin == std::string::npos || end == std::string::npos || end <= begin + 1) {
+			continue;
+		}
+		std::string records = report.substr(begin + 1, end - begin - 1);
+		records.erase(records.find_last_not_of("\n") + 1);
+		if (records.find_first_not_of("\n ") == std::string::npos) {
+			continue;
+		}
+		out<<(first ? "" : ",")<<records;
+		first = false;
+	}
+	out<<"\n]\n}\n";
+	return true;
+}
+
+/**
+ * \brief Snapshot of clocks and allocation counters
+ */
+struct Measurement {
+	std::chrono::steady_clock::time_point wall;
+	std::clock_t cpu;
+	alloc_counter::AllocationStats allocations;
+
+	static Measurement now() {
+		return {std::chrono::steady_clock::now(), std::clock(), alloc_counter::total()};
+	}
+};
+
+/**
+ * \brief Costs accumulated between pairs of measurements
+ */
+struct Cost {
+	double wall_ms = 0;
+	double cpu_ms = 0;
+	alloc_counter::AllocationStats allocations;
+
+	void add(const Measurement& start, const Measurement& end) {
+		wall_ms += std::chrono::duration<double, std::milli>(end.wall - start.wall).count();
+		cpu_ms += 1000.0 * (end.cpu - start.cpu) / CLOCKS_PER_SEC;
+		auto diff = end.allocations - start.allocations;
+		allocations.allocations += diff.allocations;
+		allocations.deallocations += diff.deallocations;
+		allocations.bytes += diff.bytes;
+	}
+};
+
+void write_cost(std::ostream& out, const Cost& cost) {
+	out<<"\"wall_ms\": "<<cost.wall_ms
+		<<", \"cpu_ms\": "<<cost.cpu_ms
+		<<", \"allocations\": "<<cost.allocations.allocations
+		<<", \"deallocations\": "<<cost.allocations.deallocations
+		<<", \"allocated_bytes\": "<<cost.allocations.bytes;
+}
+
+struct SubcaseRecord {
+	std::string path;	/**< Names of enclosing subcases and this subcase joined with "/" */
+	int runs = 0;		/**< Subcases are entered once for each of their nested subcases */
+	Cost cost;
+};
+
+struct TestCaseRecord {
+	std::string name;
+	std::string file;
+	unsigned line = 0;
+	bool failed = false;
+	Cost cost;
+	std::vector<SubcaseRecord> subcases;
+};
+
+/**
+ * \brief Doctest listener measuring each test case and subcase
+ *
+ * Bookkeeping is done with allocation counting paused, so only allocations of the tests (and of doctest itself) are counted.
+ */
+class PerfListener: public doctest::IReporter {
+private:
+	std::vector<TestCaseRecord> test_cases;
+	TestCaseRecord current;
+	Measurement current_start;
+	std::vector<std::pair<std::string, Measurement>> subcase_stack;
+
+	void write_report(std::ostream& out) const {
+		out<<"{\n\"test_cases\": [";
+		for (std::size_t i = 0; i < test_cases.size(); i++) {
+			const TestCaseRecord& record = test_cases[i];
+			out<<(i ? ",\n" : "\n")<<"  {\"name\": ";
+			write_json_string(out, record.name);
+			out<<", \"file\": ";
+			write_json_string(out, record.file);
+			out<<", \"line\": "<<record.line<<", \"failed\": "<<(record.failed ? "true" : "false")<<", ";
+			write_cost(out, record.cost);
+			out<<", \"subcases\": [";
+			for (std::size_t j = 0; j < record.subcases.size(); j++) {
+				const SubcaseRecord& subcase = record.subcases[j];
+				out<<(j ? ",\n" : "\n")<<"    {\"path\": ";
+				write_json_string(out, subcase.path);
+				out<<", \"runs\": "<<subcase.runs<<", ";
+				write_cost(out, subcase.cost);
+				out<<"}";
+			}
+			out<<"]}";
+		}
+		out<<"\n]\n}\n";
+	}
+public:
+	PerfListener(const doctest::ContextOptions&) {}
+
+	void report_query(const doctest::QueryData&) override {}
+
+	void test_run_start() override {
+		alloc_counter::PauseScope pause;
+		test_cases.clear();
+	}
+
+	void test_run_end(const doctest::TestRunStats&) override {
+		alloc_counter::PauseScope pause;
+		if (output_path.empty()) {
+			return;
+		}
+		std::ofstream out{output_path};
+		if (!out) {
+			std::cerr<<"perf report: can't write "<<output_path<<std::endl;
+			return;
+		}
+		write_report(out);
+	}
+
+	void test_case_start(const doctest::TestCaseData& test_case) override {
+		{
+			alloc_counter::PauseScope pause;
+			current = TestCaseRecord{};
+			current.name = test_case.m_name;
+			current.file = test_case.m_file.c_str();
+			current.line = test_case.m_line;
+			subcase_stack.clear();
+		}
+		current_start = Measurement::now();
+	}
+
+	void test_case_reenter(const doctest::TestCaseData&) override {
+		alloc_counter::PauseScope pause;
+		subcase_stack.clear();
+	}
+
+	void test_case_end(const doctest::CurrentTestCaseStats& stats) override {
+		Measurement end = Measurement::now();
+		alloc_counter::PauseScope pause;
+		current.cost.add(current_start, end);
+		current.failed = stats.failure_flags != 0;
+		test_cases.push_back(std::move(current));
+	}
+
+	void test_case_exception(const doctest::TestCaseException&) override {}
+
+	void subcase_start(const doctest::SubcaseSignature& signature) override {
+		{
+			alloc_counter::PauseScope pause;
+			std::string path = subcase_stack.empty() ? "" : subcase_stack.back().first + "/";
+			path += signature.m_name.c_str();
+			subcase_stack.emplace_back(std::move(path), Measurement{});
+		}
+		subcase_stack.back().second = Measurement::now();
+	}
+
+	void subcase_end() override {
+		Measurement end = Measurement::now();
+		alloc_counter::PauseScope pause;
+		if (subcase_stack.empty()) {
+			return;
+		}
+		const auto& started = subcase_stack.back();
+		SubcaseRecord* record = nullptr;
+		for (auto& subcase: current.subcases) {
+			if (subcase.path == started.first) {
+				record = &subcase;
+			}
+		}
+		if (!record) {
+			current.subcases.emplace_back();
+			record = &current.subcases.back();
+			record->path = started.first;
+		}
+		record->runs++;
+		record->cost.add(started.second, end);
+		subcase_stack.pop_back();
+	}
+
+	void log_assert(const doctest::AssertData&) override {}
+
+	void log_message(const doctest::MessageData&) override {}
+
+	void test_case_skipped(const doctest::TestCaseData&) override {}
+};
+
+}
+
+DOCTEST_REGISTER_LISTENER("perf", 1, perf_report::PerfListener);
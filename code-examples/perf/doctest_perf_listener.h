@@ -0,0 +1,49 @@
+/*
+ * doctest_perf_listener.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_PERF_DOCTEST_PERF_LISTENER_H_
+#define CODE_EXAMPLES_PERF_DOCTEST_PERF_LISTENER_H_
+
+#include <string>
+#include <vector>
+
+/**
+ * \brief Per test case performance report of the doctest runner
+ *
+ * The "perf" listener (doctest_perf_listener.cpp) measures wall time, CPU time and heap allocations
+ * of each test case and subcase. The report is written only if an output file was set.
+ */
+namespace perf_report {
+
+/**
+ * \brief Set the JSON file written at the end of the test run, empty path disables the report
+ */
+void set_output(const std::string& path);
+
+/**
+ * \brief Takes "--perf-report=<file>" from command line arguments (if present) and sets it as the output
+ *
+ * Doctest ignores unknown options, so the arguments can be passed to doctest::Context as is.
+ */
+void apply_command_line(int argc, char** argv);
+
+/**
+ * \brief Current output file, empty if the report is disabled
+ */
+const std::string& output();
+
+/**
+ * \brief Combine reports written by several runs (e.g. by test shards) into one report
+ *
+ * Test cases are concatenated in the order of inputs, missing inputs are skipped. Input files are removed.
+ * \return false if path can't be written
+ */
+bool merge(const std::vector<std::string>& inputs, const std::string& path);
+
+}
+
+#endif /* CODE_EXAMPLES_PERF_DOCTEST_PERF_LISTENER_H_ */
@@ -0,0 +1,65 @@
+/*
+ * doctest_trace_listener.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "trace.h"
+
+#include "../doctest.h"
+
+#include <cstdint>
+
+namespace trace {
+
+/**
+ * \brief Doctest listener adding a slice per test case to the trace (see trace.h), writes the trace at the end
+ *
+ * Not a TRACE_SCOPE: test cases are on the timeline even when the macros are compiled out.
+ */
+class TraceListener: public doctest::IReporter {
+private:
+	const char* test_case_name = nullptr;	// test case names are string literals
+	std::uint64_t test_case_started = 0;
+public:
+	TraceListener(const doctest::ContextOptions&) {}
+
+	void report_query(const doctest::QueryData&) override {}
+
+	void test_run_start() override {}
+
+	void test_run_end(const doctest::TestRunStats&) override {
+		write();
+	}
+
+	void test_case_start(const doctest::TestCaseData& test_case) override {
+		test_case_name = test_case.m_name;
+		test_case_started = now_ns();
+	}
+
+	void test_case_reenter(const doctest::TestCaseData&) override {}
+
+	void test_case_end(const doctest::CurrentTestCaseStats&) override {
+		if (enabled()) {
+			flush(); // events of the test case, the ring buffers are small
+			record_complete(test_case_name, test_case_started, now_ns());
+		}
+	}
+
+	void test_case_exception(const doctest::TestCaseException&) override {}
+
+	void subcase_start(const doctest::SubcaseSignature&) override {}
+
+	void subcase_end() override {}
+
+	void log_assert(const doctest::AssertData&) override {}
+
+	void log_message(const doctest::MessageData&) override {}
+
+	void test_case_skipped(const doctest::TestCaseData&) override {}
+};
+
+}
+
+DOCTEST_REGISTER_LISTENER("trace", 4, trace::TraceListener);
@@ -0,0 +1,137 @@
+/*
+ * hw_counters.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "hw_counters.h"
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace hw_counters {
+
+const char* name(Event event) {
+	switch (event) {
+	case cycles: return "cycles";
+	case instructions: return "instructions";
+	case cache_misses: return "cache_misses";
+	case branch_misses: return "branch_misses";
+	default: return "unknown";
+	}
+}
+
+double Counts::ipc() const {
+	if (!valid[cycles] || !valid[instructions] || values[cycles] <= 0) {
+		return 0;
+	}
+	return values[instructions] / values[cycles];
+}
+
+Counts Counts::operator-(const Counts& other) const {
+	Counts result;
+	for (int e = 0; e < event_count; e++) {
+		result.valid[e] = valid[e] && other.valid[e];
+		result.values[e] = result.valid[e] ? values[e] - other.values[e] : 0;
+	}
+	return result;
+}
+
+#ifdef __linux__
+
+namespace {
+
+unsigned long long config(Event event) {
+	switch (event) {
+	case cycles: return PERF_COUNT_HW_CPU_CYCLES;
+	case instructions: return PERF_COUNT_HW_INSTRUCTIONS;
+	case cache_misses: return PERF_COUNT_HW_CACHE_MISSES;
+	default: return PERF_COUNT_HW_BRANCH_MISSES;
+	}
+}
+
+int open_counter(Event event) {
+	perf_event_attr attributes;
+	std::memset(&attributes, 0, sizeof(attributes));
+	attributes.type = PERF_TYPE_HARDWARE;
+	attributes.size = sizeof(attributes);
+	attributes.config = config(event);
+	attributes.exclude_kernel = 1;
+	attributes.exclude_hv = 1;
+	attributes.inherit = 1;
+	attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+	// this thread on any CPU
+	return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+}
+
+}
+
+Counters::Counters() {
+	for (int e = 0; e < event_count; e++) {
+		descriptors[e] = open_counter(static_cast<Event>(e));
+		if (descriptors[e] < 0) {
+			if (!_error.empty()) {
+				_error += "; ";
+			}
+			_error += std::string{name(static_cast<Event>(e))} + ": perf_event_open failed: " + std::strerror(errno);
+		}
+	}
+}
+
+Counters::~Counters() {
+	for (int descriptor: descriptors) {
+		if (descriptor >= 0) {
+			close(descriptor);
+		}
+	}
+}
+
+Counts Counters::read() const {
+	Counts result;
+	for (int e = 0; e < event_count; e++) {
+		std::uint64_t data[3]; // value, time enabled, time running
+		if (descriptors[e] < 0 || ::read(descriptors[e], data, sizeof(data)) != sizeof(data)) {
+			continue;
+		}
+		if (data[2] == 0 && data[1] > 0) { // enabled, but the PMU never had room for it
+			continue;
+		}
+		result.values[e] = data[2] > 0 && data[2] < data[1] ? double(data[0]) * data[1] / data[2] : double(data[0]);
+		result.valid[e] = true;
+	}
+	return result;
+}
+
+#else
+
+Counters::Counters(): _error{"hardware counters need perf_event_open (Linux)"} {
+	for (int& descriptor: descriptors) {
+		descriptor = -1;
+	}
+}
+
+Counters::~Counters() {}
+
+Counts Counters::read() const {
+	return Counts{};
+}
+
+#endif
+
+bool Counters::available() const {
+	for (int descriptor: descriptors) {
+		if (descriptor >= 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+}
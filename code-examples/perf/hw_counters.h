@@ -0,0 +1,81 @@
+/*
+ * hw_counters.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_PERF_HW_COUNTERS_H_
+#define CODE_EXAMPLES_PERF_HW_COUNTERS_H_
+
+#include <string>
+
+/**
+ * \brief Hardware performance counters of the calling thread (Linux perf_event_open)
+ *
+ * Counters are often unavailable: in containers and VMs without a virtual PMU, with kernel.perf_event_paranoid > 2,
+ * or on other systems than Linux. Then Counters::available() is false, error() tells why and all counts are invalid.
+ * A single event can be missing too (e.g. cache misses on some VMs), its count is invalid and the others work.
+ */
+namespace hw_counters {
+
+enum Event { cycles, instructions, cache_misses, branch_misses, event_count };
+
+/**
+ * \brief Name of event as used in reports: "cycles", "instructions", "cache_misses", "branch_misses"
+ */
+const char* name(Event event);
+
+/**
+ * \brief Counter values, valid[e] is false if event e could not be counted
+ *
+ * Values are scaled by enabled/running time when the kernel multiplexes counters, then they are estimates.
+ */
+struct Counts {
+	double values[event_count] = {};
+	bool valid[event_count] = {};
+
+	/**
+	 * \brief Instructions per cycle, 0 if either count is invalid
+	 */
+	double ipc() const;
+
+	/**
+	 * \brief Differences of valid values (valid in both)
+	 */
+	Counts operator-(const Counts& other) const;
+};
+
+/**
+ * \brief Counters of user space events of the calling thread and of threads it creates (after they exit)
+ *
+ * Counting starts in the constructor, differences of read() give counts of the code between the reads.
+ */
+class Counters {
+private:
+	int descriptors[event_count];
+	std::string _error;
+public:
+	Counters();
+	~Counters();
+	Counters(const Counters&) = delete;
+	Counters& operator=(const Counters&) = delete;
+
+	/**
+	 * \brief At least one event is counted
+	 */
+	bool available() const;
+
+	/**
+	 * \brief Why the events which are not counted failed to open, empty if all are counted
+	 */
+	const std::string& error() const {
+		return _error;
+	}
+
+	Counts read() const;
+};
+
+}
+
+#endif /* CODE_EXAMPLES_PERF_HW_COUNTERS_H_ */
@@ -0,0 +1,156 @@
+/*
+ * hw_report.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "hw_report.h"
+#include "alloc_counter.h"
+#include "hw_counters.h"
+#include "json.h"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace hw_report {
+
+namespace {
+
+const char* option_prefix = "--hw-report=";
+
+struct Record {
+	std::string name;
+	std::string file;
+	unsigned line = 0;
+	bool failed = false;
+	long long elements = 0;
+	hw_counters::Counts counts;
+};
+
+std::string output_path;
+std::unique_ptr<hw_counters::Counters> counters;	/**< Opened by the first test case when the report is enabled */
+std::vector<Record> records;
+Record current;
+hw_counters::Counts current_start;
+
+void write_count(std::ostream& out, const hw_counters::Counts& counts, hw_counters::Event event, long long elements) {
+	out<<", \""<<hw_counters::name(event)<<"\": ";
+	if (counts.valid[event]) {
+		out<<counts.values[event];
+	} else {
+		out<<"null";
+	}
+	if (elements > 0) {
+		out<<", \""<<hw_counters::name(event)<<"_per_element\": ";
+		if (counts.valid[event]) {
+			out<<counts.values[event] / elements;
+		} else {
+			out<<"null";
+		}
+	}
+}
+
+void write_record(std::ostream& out, const Record& record, bool available) {
+	out<<"  {\"name\": ";
+	write_json_string(out, record.name);
+	out<<", \"file\": ";
+	write_json_string(out, record.file);
+	out<<", \"line\": "<<record.line<<", \"failed\": "<<(record.failed ? "true" : "false")
+		<<", \"available\": "<<(available ? "true" : "false");
+	for (int e = 0; e < hw_counters::event_count; e++) {
+		write_count(out, record.counts, static_cast<hw_counters::Event>(e), record.elements);
+	}
+	out<<", \"ipc\": ";
+	if (record.counts.valid[hw_counters::cycles] && record.counts.valid[hw_counters::instructions]) {
+		out<<record.counts.ipc();
+	} else {
+		out<<"null";
+	}
+	if (record.elements > 0) {
+		out<<", \"elements\": "<<record.elements;
+	}
+	out<<"}";
+}
+
+}
+
+void set_output(const std::string& path) {
+	output_path = path;
+}
+
+bool is_option(const char* argument) {
+	return std::strncmp(argument, option_prefix, std::strlen(option_prefix)) == 0;
+}
+
+void apply_command_line(int argc, char** argv) {
+	for (int i = 1; i < argc; i++) {
+		if (is_option(argv[i])) {
+			set_output(argv[i] + std::strlen(option_prefix));
+		}
+	}
+}
+
+const std::string& output() {
+	return output_path;
+}
+
+void set_elements(long long elements) {
+	current.elements = elements;
+}
+
+void test_case_start(const std::string& name, const std::string& file, unsigned line) {
+	if (output_path.empty()) {
+		return;
+	}
+	{
+		alloc_counter::PauseScope pause;
+		if (!counters) {
+			counters.reset(new hw_counters::Counters{});
+			if (!counters->available()) {
+				std::cerr<<"hw report: counters are unavailable, counts will be null ("<<counters->error()<<")"<<std::endl;
+			}
+		}
+		current = Record{};
+		current.name = name;
+		current.file = file;
+		current.line = line;
+	}
+	current_start = counters->read();
+}
+
+void test_case_end(bool failed) {
+	if (output_path.empty() || !counters) {
+		return;
+	}
+	hw_counters::Counts end = counters->read();
+	alloc_counter::PauseScope pause;
+	current.counts = end - current_start;
+	current.failed = failed;
+	records.push_back(std::move(current));
+}
+
+void write() {
+	if (output_path.empty()) {
+		return;
+	}
+	alloc_counter::PauseScope pause;
+	std::ofstream out{output_path};
+	if (!out) {
+		std::cerr<<"hw report: can't write "<<output_path<<std::endl;
+		return;
+	}
+	bool available = counters && counters->available();
+	out<<"{\n\"test_cases\": [";
+	for (std::size_t i = 0; i < records.size(); i++) {
+		out<<(i ? ",\n" : "\n");
+		write_record(out, records[i], available);
+	}
+	out<<"\n]\n}\n";
+	records.clear();
+}
+
+}
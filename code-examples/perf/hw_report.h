@@ -0,0 +1,64 @@
+/*
+ * hw_report.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_PERF_HW_REPORT_H_
+#define CODE_EXAMPLES_PERF_HW_REPORT_H_
+
+#include <string>
+
+/**
+ * \brief Per test case hardware counter report (cycles, instructions, IPC, cache and branch misses)
+ *
+ * Filled by the "hw" doctest listener (doctest_hw_listener.cpp) and by the Catch2 listener (catch_hw_listener.cpp).
+ * Counting is off unless an output file is set. If counters are unavailable, the tests still run,
+ * a warning is printed once and the report has "available": false with null counts.
+ * The JSON has the same layout as perf_report, so perf_report::merge() combines shard reports.
+ */
+namespace hw_report {
+
+/**
+ * \brief Set the JSON file written at the end of the test run, empty path disables counting
+ */
+void set_output(const std::string& path);
+
+/**
+ * \brief Takes "--hw-report=<file>" from command line arguments (if present) and sets it as the output
+ */
+void apply_command_line(int argc, char** argv);
+
+/**
+ * \brief true for the argument handled by apply_command_line() - for runners which reject unknown options (Catch2)
+ */
+bool is_option(const char* argument);
+
+const std::string& output();
+
+/**
+ * \brief Number of elements the current test case processed, adds per element counts to its record
+ *
+ * Called from a test, e.g. after a loop over a list of n elements: hw_report::set_elements(n).
+ */
+void set_elements(long long elements);
+
+/**
+ * \brief Start counting a test case, called by the listeners
+ */
+void test_case_start(const std::string& name, const std::string& file, unsigned line);
+
+/**
+ * \brief Stop counting the current test case, called by the listeners
+ */
+void test_case_end(bool failed);
+
+/**
+ * \brief Write the report to output(), called by the listeners at the end of the run
+ */
+void write();
+
+}
+
+#endif /* CODE_EXAMPLES_PERF_HW_REPORT_H_ */
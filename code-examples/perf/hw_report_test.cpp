@@ -0,0 +1,95 @@
+/*
+ * hw_report_test.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "hw_counters.h"
+#include "hw_report.h"
+
+#include "../doctest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+TEST_CASE("[hw counters] - counts or explains why not") {
+	hw_counters::Counters counters;
+	if (!counters.available()) {
+		MESSAGE("hardware counters unavailable: " << counters.error());
+		CHECK_FALSE(counters.error().empty());
+		hw_counters::Counts counts = counters.read();
+		for (bool valid: counts.valid) {
+			CHECK_FALSE(valid);
+		}
+		CHECK(counts.ipc() == 0);
+		return;
+	}
+	hw_counters::Counts before = counters.read();
+	volatile long long sum = 0;
+	for (int i = 0; i < 1000000; i++) {
+		sum = sum + i;
+	}
+	hw_counters::Counts used = counters.read() - before;
+	if (used.valid[hw_counters::instructions]) {
+		CHECK(used.values[hw_counters::instructions] > 1000000);
+	}
+}
+
+TEST_CASE("[hw counters] - differences and IPC") {
+	hw_counters::Counts a;
+	a.values[hw_counters::cycles] = 300;
+	a.values[hw_counters::instructions] = 700;
+	a.valid[hw_counters::cycles] = a.valid[hw_counters::instructions] = true;
+	hw_counters::Counts b;
+	b.values[hw_counters::cycles] = 100;
+	b.values[hw_counters::instructions] = 100;
+	b.valid[hw_counters::cycles] = b.valid[hw_counters::instructions] = true;
+
+	hw_counters::Counts diff = a - b;
+	CHECK(diff.values[hw_counters::cycles] == 200);
+	CHECK(diff.ipc() == doctest::Approx(3.0));
+	CHECK_FALSE(diff.valid[hw_counters::cache_misses]);
+
+	b.valid[hw_counters::cycles] = false;
+	CHECK((a - b).ipc() == 0);
+	CHECK(std::string{hw_counters::name(hw_counters::branch_misses)} == "branch_misses");
+}
+
+TEST_CASE("[hw report] - JSON report") {
+	if (!hw_report::output().empty()) {
+		MESSAGE("skipped: the report of this run is being recorded");
+		return;
+	}
+	char argument[] = "--hw-report=hw_report_test.json";
+	char* argv[] = {argument, argument};
+	CHECK(hw_report::is_option(argument));
+	CHECK_FALSE(hw_report::is_option("--perf-report=x"));
+	hw_report::apply_command_line(2, argv);
+	REQUIRE(hw_report::output() == "hw_report_test.json");
+
+	hw_report::test_case_start("loop \"quoted\"", "file.cpp", 7);
+	volatile int sink = 0;
+	for (int i = 0; i < 1000; i++) {
+		sink = sink + i;
+	}
+	hw_report::set_elements(1000);
+	hw_report::test_case_end(false);
+	hw_report::write();
+	hw_report::set_output("");
+
+	std::ifstream in{"hw_report_test.json"};
+	std::stringstream buffer;
+	buffer<<in.rdbuf();
+	in.close();
+	std::remove("hw_report_test.json");
+	std::string report = buffer.str();
+	CHECK(report.find("\"test_cases\": [") != std::string::npos);
+	CHECK(report.find("\"name\": \"loop \\\"quoted\\\"\"") != std::string::npos);
+	CHECK(report.find("\"line\": 7") != std::string::npos);
+	CHECK(report.find("\"elements\": 1000") != std::string::npos);
+	CHECK(report.find("\"ipc\": ") != std::string::npos);
+	CHECK(report.find("\"cache_misses_per_element\": ") != std::string::npos);
+}
@@ -0,0 +1,42 @@
+/*
+ * json.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_PERF_JSON_H_
+#define CODE_EXAMPLES_PERF_JSON_H_
+
+#include <cstdio>
+#include <ostream>
+#include <string>
+
+/**
+ * \brief Writes str to out as a quoted JSON string
+ *
+ * Escapes quotes, backslashes and control characters, other bytes are written as is (UTF-8 passes through).
+ */
+inline void write_json_string(std::ostream& out, const std::string& str) {
+	out<<'"';
+	for (char c: str) {
+		switch (c) {
+		case '"': out<<"\\\""; break;
+		case '\\': out<<"\\\\"; break;
+		case '\n': out<<"\\n"; break;
+		case '\r': out<<"\\r"; break;
+		case '\t': out<<"\\t"; break;
+		default:
+			if (static_cast<unsigned char>(c) < 0x20) {
+				char buf[8];
+				std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+				out<<buf;
+			} else {
+				out<<c;
+			}
+		}
+	}
+	out<<'"';
+}
+
+#endif /* CODE_EXAMPLES_PERF_JSON_H_ */
@@ -0,0 +1,133 @@
+/*
+ * latency_bench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "latency_histogram.h"
+#include "../lab_k29_11_09_20.h"
+#include "../list/list.h"
+#include "../rational.h"
+#include "../commands.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace bench_latency {
+
+using clock = std::chrono::steady_clock;
+
+/**
+ * \brief Latency of every single call of operation, in nanoseconds, includes the cost of reading the clock twice
+ */
+template<typename Operation>
+void record_latencies(LatencyHistogram& histogram, long samples, Operation operation) {
+	long long checksum = 0;
+	for (long i = 0; i < samples; i++) {
+		auto begin = clock::now();
+		checksum += operation(i);
+		auto end = clock::now();
+		histogram.record(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()));
+	}
+	volatile long long sink = checksum;
+	(void)sink;
+}
+
+/**
+ * \brief Each thread records into its own histogram (no shared cache lines), they are merged at the end
+ *
+ * MakeOperation is called in each thread, so every thread works on its own data.
+ */
+template<typename MakeOperation>
+std::unique_ptr<LatencyHistogram> measure(int thread_count, long samples, MakeOperation make_operation) {
+	std::vector<std::unique_ptr<LatencyHistogram>> histograms;
+	for (int i = 0; i < thread_count; i++) {
+		histograms.push_back(std::make_unique<LatencyHistogram>());
+	}
+	std::vector<std::thread> threads;
+	for (int i = 0; i < thread_count; i++) {
+		threads.emplace_back([&, i]() {
+			auto operation = make_operation();
+			record_latencies(*histograms[i], samples, operation);
+		});
+	}
+	for (auto& thread: threads) {
+		thread.join();
+	}
+	auto merged = std::make_unique<LatencyHistogram>();
+	for (auto& histogram: histograms) {
+		merged->merge(*histogram);
+	}
+	return merged;
+}
+
+void report(const char* name, const LatencyHistogram& histogram) {
+	std::cout<<std::left<<std::setw(24)<<name<<std::right;
+	for (std::uint64_t value: {histogram.min(), histogram.percentile(50), histogram.percentile(90), histogram.percentile(99),
+			histogram.percentile(99.9), histogram.max()}) {
+		std::cout<<"\t"<<value;
+	}
+	std::cout<<std::endl;
+}
+
+int main(int argc, char** argv) {
+	long samples = argc > 1 ? std::atol(argv[1]) : 1000000;
+	int thread_count = argc > 2 ? std::atoi(argv[2]) : 1;
+
+	std::cout<<samples<<" calls per thread, "<<thread_count<<" threads, latencies in ns (including two clock reads)"<<std::endl;
+	std::cout<<std::left<<std::setw(24)<<"operation"<<std::right<<"\tmin\tp50\tp90\tp99\tp99.9\tmax"<<std::endl;
+
+	report("clock only", *measure(thread_count, samples, []() {
+		return [](long i) { return i; };
+	}));
+
+	// the list grows to samples elements: the tail shows the allocator getting new pages
+	report("DoublyLinkedList append", *measure(thread_count, samples, []() {
+		auto list = std::make_shared<DoublyLinkedList<long>>();
+		return [list](long i) {
+			list->append(i);
+			return 0L;
+		};
+	}));
+
+	report("Rational +", *measure(thread_count, samples, []() {
+		return [](long i) {
+			Rational sum = Rational{static_cast<int>(i % 1000) + 1, 7} + Rational{3, static_cast<int>(i % 997) + 1};
+			return static_cast<long>(sum.get_numerator());
+		};
+	}));
+
+	report("Rational /", *measure(thread_count, samples, []() {
+		return [](long i) {
+			Rational quotient = Rational{static_cast<int>(i % 1000) + 1, 7} / Rational{3, static_cast<int>(i % 997) + 1};
+			return static_cast<long>(quotient.get_denominator());
+		};
+	}));
+
+	// string prints from every constructor and std::cout is shared by all threads: one thread, output disabled
+	std::streambuf* buffer = std::cout.rdbuf(nullptr);
+	auto concatenation = measure(1, samples, []() {
+		auto hello = std::make_shared<lab_k29_11_09_20::string>("hello ");
+		auto world = std::make_shared<lab_k29_11_09_20::string>("world");
+		return [hello, world](long) {
+			lab_k29_11_09_20::string result = *hello + *world;
+			return 1L;
+		};
+	});
+	std::cout.rdbuf(buffer);
+	std::cout.clear();
+	report("string + (1 thread)", *concatenation);
+	return 0;
+}
+
+static commands::Registrar registrar{"bench_latency", commands::Kind::benchmark, main,
+		"latency percentiles of list append, Rational and string operations", {"20000", "2"}};
+
+}
@@ -0,0 +1,153 @@
+/*
+ * latency_histogram.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "latency_histogram.h"
+
+#include <cmath>
+
+namespace {
+
+int highest_bit(std::uint64_t value) {
+#if defined(__GNUC__)
+	return 63 - __builtin_clzll(value);
+#else
+	int bit = 0;
+	while (value >>= 1) {
+		bit++;
+	}
+	return bit;
+#endif
+}
+
+void store_min(std::atomic<std::uint64_t>& target, std::uint64_t value) {
+	std::uint64_t current = target.load(std::memory_order_relaxed);
+	while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+	}
+}
+
+void store_max(std::atomic<std::uint64_t>& target, std::uint64_t value) {
+	std::uint64_t current = target.load(std::memory_order_relaxed);
+	while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+	}
+}
+
+}
+
+LatencyHistogram::LatencyHistogram() {
+	for (auto& count: counts) {
+		count.store(0, std::memory_order_relaxed);
+	}
+}
+
+std::size_t LatencyHistogram::bucket_of(std::uint64_t value) {
+	if (value < sub_bucket_count) {
+		return static_cast<std::size_t>(value);
+	}
+	// value has precision_bits + shift significant bits, the lowest shift bits are dropped
+	int shift = highest_bit(value) - precision_bits + 1;
+	return static_cast<std::size_t>(shift) * half_count + static_cast<std::size_t>(value >> shift);
+}
+
+std::uint64_t LatencyHistogram::bucket_lowest(std::size_t bucket) {
+	if (bucket < sub_bucket_count) {
+		return bucket;
+	}
+	std::size_t shift = bucket / half_count - 1;
+	std::uint64_t top = bucket - shift * half_count;	// in [half_count, sub_bucket_count)
+	return top << shift;
+}
+
+std::uint64_t LatencyHistogram::bucket_highest(std::size_t bucket) {
+	if (bucket < sub_bucket_count) {
+		return bucket;
+	}
+	std::size_t shift = bucket / half_count - 1;
+	return bucket_lowest(bucket) + ((std::uint64_t{1} << shift) - 1);
+}
+
+void LatencyHistogram::record(std::uint64_t value, std::uint64_t count) {
+	counts[bucket_of(value)].fetch_add(count, std::memory_order_relaxed);
+	total.fetch_add(count, std::memory_order_relaxed);
+	sum.fetch_add(value * count, std::memory_order_relaxed);
+	store_min(minimum, value);
+	store_max(maximum, value);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+	for (std::size_t i = 0; i < bucket_count; i++) {
+		std::uint64_t count = other.counts[i].load(std::memory_order_relaxed);
+		if (count) {
+			counts[i].fetch_add(count, std::memory_order_relaxed);
+		}
+	}
+	std::uint64_t other_total = other.total.load(std::memory_order_relaxed);
+	if (other_total) {
+		total.fetch_add(other_total, std::memory_order_relaxed);
+		sum.fetch_add(other.sum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		store_min(minimum, other.minimum.load(std::memory_order_relaxed));
+		store_max(maximum, other.maximum.load(std::memory_order_relaxed));
+	}
+}
+
+void LatencyHistogram::reset() {
+	for (auto& count: counts) {
+		count.store(0, std::memory_order_relaxed);
+	}
+	total.store(0, std::memory_order_relaxed);
+	sum.store(0, std::memory_order_relaxed);
+	minimum.store(UINT64_MAX, std::memory_order_relaxed);
+	maximum.store(0, std::memory_order_relaxed);
+}
+
+std::uint64_t LatencyHistogram::count() const {
+	return total.load(std::memory_order_relaxed);
+}
+
+std::uint64_t LatencyHistogram::min() const {
+	return count() ? minimum.load(std::memory_order_relaxed) : 0;
+}
+
+std::uint64_t LatencyHistogram::max() const {
+	return count() ? maximum.load(std::memory_order_relaxed) : 0;
+}
+
+double LatencyHistogram::mean() const {
+	std::uint64_t values = count();
+	return values ? static_cast<double>(sum.load(std::memory_order_relaxed)) / values : 0;
+}
+
+std::uint64_t LatencyHistogram::percentile(double percentile) const {
+	std::uint64_t values = count();
+	if (values == 0) {
+		return 0;
+	}
+	if (percentile <= 0) {
+		return min();
+	}
+	// 1-based rank of the smallest value with percentile % of the values not larger. The epsilon keeps products
+	// which are whole numbers up to rounding whole: 99.9 / 100 * 1000 is 999.0000000000001
+	std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(percentile / 100 * values - 1e-9));
+	if (rank < 1) {
+		rank = 1;
+	}
+	std::uint64_t seen = 0;
+	for (std::size_t i = 0; i < bucket_count; i++) {
+		seen += counts[i].load(std::memory_order_relaxed);
+		if (seen >= rank) {
+			std::uint64_t highest = bucket_highest(i);
+			return highest < max() ? highest : max();
+		}
+	}
+	return max();
+}
+
+std::ostream& operator<<(std::ostream& out, const LatencyHistogram& histogram) {
+	return out<<"count="<<histogram.count()<<" min="<<histogram.min()
+			<<" p50="<<histogram.percentile(50)<<" p90="<<histogram.percentile(90)
+			<<" p99="<<histogram.percentile(99)<<" p99.9="<<histogram.percentile(99.9)
+			<<" max="<<histogram.max();
+}
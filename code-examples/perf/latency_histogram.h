@@ -0,0 +1,91 @@
+/*
+ * latency_histogram.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_PERF_LATENCY_HISTOGRAM_H_
+#define CODE_EXAMPLES_PERF_LATENCY_HISTOGRAM_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * \brief Histogram of latencies (or any non-negative integers) with log-linear buckets, in the style of HdrHistogram
+ *
+ * Values below 2^precision_bits have their own buckets. Larger values are grouped by the position of the highest
+ * set bit, each such range [2^k, 2^(k+1)) is split into 2^(precision_bits-1) equal buckets, so a bucket is
+ * never wider than 1/2^(precision_bits-1) of its values (below 1.6% with 7 bits). All of uint64_t is covered
+ * by a fixed array of counters (under 30 KB), nothing is allocated while recording.
+ *
+ * record() is lock-free (relaxed atomic increments) and can be called by many threads at once.
+ * To avoid contention on the counters, each thread can record into its own histogram and merge() them at the end.
+ * Reading (percentiles, count) while other threads record gives some recent state, not a snapshot.
+ */
+class LatencyHistogram {
+public:
+	static constexpr int precision_bits = 7;
+	static constexpr std::size_t sub_bucket_count = std::size_t{1} << precision_bits;
+	static constexpr std::size_t half_count = sub_bucket_count / 2;
+	static constexpr std::size_t bucket_count = (64 - precision_bits + 2) * half_count;
+private:
+	std::atomic<std::uint64_t> counts[bucket_count];
+	std::atomic<std::uint64_t> total{0};
+	std::atomic<std::uint64_t> minimum{UINT64_MAX};
+	std::atomic<std::uint64_t> maximum{0};
+	std::atomic<std::uint64_t> sum{0};	/**< Wraps around after 2^64, only for mean() */
+public:
+	LatencyHistogram();
+	LatencyHistogram(const LatencyHistogram&) = delete;
+	LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+	/**
+	 * \brief Index of the bucket of value
+	 */
+	static std::size_t bucket_of(std::uint64_t value);
+
+	/**
+	 * \brief Smallest and largest values of a bucket
+	 */
+	static std::uint64_t bucket_lowest(std::size_t bucket);
+	static std::uint64_t bucket_highest(std::size_t bucket);
+
+	/**
+	 * \brief Count value once (or count times), lock-free
+	 */
+	void record(std::uint64_t value, std::uint64_t count = 1);
+
+	/**
+	 * \brief Add all counts of other, lock-free
+	 */
+	void merge(const LatencyHistogram& other);
+
+	/**
+	 * \brief Remove all values, not to be called while other threads record
+	 */
+	void reset();
+
+	std::uint64_t count() const;
+	std::uint64_t min() const;		/**< 0 if empty */
+	std::uint64_t max() const;		/**< 0 if empty */
+	double mean() const;			/**< 0 if empty */
+
+	/**
+	 * \brief Value at percentile: at least percentile % of the recorded values are not larger
+	 *
+	 * The result is the highest value of the bucket (an upper bound), but not above max().
+	 * \param percentile in [0, 100], 0 gives min(), 100 gives max()
+	 * \return 0 if empty
+	 */
+	std::uint64_t percentile(double percentile) const;
+
+	/**
+	 * \brief One line "count=... min=... p50=... p90=... p99=... p99.9=... max=..."
+	 */
+	friend std::ostream& operator<<(std::ostream& out, const LatencyHistogram& histogram);
+};
+
+#endif /* CODE_EXAMPLES_PERF_LATENCY_HISTOGRAM_H_ */
@@ -0,0 +1,134 @@
+/*
+ * latency_histogram_test.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "latency_histogram.h"
+
+#include "../doctest.h"
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("[latency histogram] - buckets") {
+	// small values are exact
+	for (std::uint64_t value = 0; value < LatencyHistogram::sub_bucket_count; value++) {
+		REQUIRE(LatencyHistogram::bucket_of(value) == value);
+	}
+	// every value is inside its bucket, buckets are narrow and ordered
+	std::size_t previous = 0;
+	for (std::uint64_t value = 1; value < UINT64_MAX / 3; value = value * 3 / 2 + 1) {
+		std::size_t bucket = LatencyHistogram::bucket_of(value);
+		REQUIRE(bucket < LatencyHistogram::bucket_count);
+		REQUIRE(bucket >= previous);
+		REQUIRE(LatencyHistogram::bucket_lowest(bucket) <= value);
+		REQUIRE(value <= LatencyHistogram::bucket_highest(bucket));
+		double width = static_cast<double>(LatencyHistogram::bucket_highest(bucket) - LatencyHistogram::bucket_lowest(bucket));
+		REQUIRE(width <= value / 64.0);
+		previous = bucket;
+	}
+	CHECK(LatencyHistogram::bucket_of(UINT64_MAX) == LatencyHistogram::bucket_count - 1);
+	CHECK(LatencyHistogram::bucket_highest(LatencyHistogram::bucket_count - 1) == UINT64_MAX);
+	// consecutive buckets have no gaps
+	for (std::size_t bucket = 1; bucket < LatencyHistogram::bucket_count; bucket++) {
+		REQUIRE(LatencyHistogram::bucket_lowest(bucket) == LatencyHistogram::bucket_highest(bucket - 1) + 1);
+	}
+}
+
+TEST_CASE("[latency histogram] - percentiles") {
+	auto histogram = std::make_unique<LatencyHistogram>();
+	CHECK(histogram->count() == 0);
+	CHECK(histogram->percentile(99) == 0);
+	CHECK(histogram->min() == 0);
+
+	for (std::uint64_t value = 1; value <= 100000; value++) {
+		histogram->record(value);
+	}
+	CHECK(histogram->count() == 100000);
+	CHECK(histogram->min() == 1);
+	CHECK(histogram->max() == 100000);
+	CHECK(histogram->mean() == doctest::Approx(50000.5));
+	CHECK(histogram->percentile(0) == 1);
+	CHECK(histogram->percentile(100) == 100000);
+	for (double percentile: {50.0, 90.0, 99.0, 99.9}) {
+		double exact = percentile * 1000;
+		CAPTURE(percentile);
+		CHECK(histogram->percentile(percentile) >= exact);
+		CHECK(histogram->percentile(percentile) <= exact * 1.016);
+	}
+
+	SUBCASE("a few slow values decide the tail") {
+		histogram->reset();
+		histogram->record(100, 990);
+		histogram->record(5000, 9);
+		histogram->record(1000000);
+		CHECK(histogram->percentile(50) == 100);
+		CHECK(histogram->percentile(99) == 100);
+		CHECK(histogram->percentile(99.9) >= 5000);
+		CHECK(histogram->percentile(99.9) <= 5000 * 1.016);
+		CHECK(histogram->percentile(99.99) == 1000000);
+	}
+	SUBCASE("ranks round up") {
+		histogram->reset();
+		histogram->record(1);
+		histogram->record(2);
+		histogram->record(3);
+		CHECK(histogram->percentile(33) == 1);
+		CHECK(histogram->percentile(40) == 2); // 40 % of 3 values is 1.2, one value is not enough
+		CHECK(histogram->percentile(66) == 2);
+		CHECK(histogram->percentile(67) == 3);
+		histogram->reset();
+		histogram->record(1, 999);
+		histogram->record(2);
+		CHECK(histogram->percentile(99.9) == 1);
+	}
+	SUBCASE("text") {
+		histogram->reset();
+		histogram->record(7);
+		std::ostringstream out;
+		out<<*histogram;
+		CHECK(out.str() == "count=1 min=7 p50=7 p90=7 p99=7 p99.9=7 max=7");
+	}
+}
+
+TEST_CASE("[latency histogram] - recording from threads and merging") {
+	const int thread_count = 4;
+	const std::uint64_t per_thread = 20000;
+	auto shared = std::make_unique<LatencyHistogram>();
+	std::vector<std::unique_ptr<LatencyHistogram>> own;
+	for (int i = 0; i < thread_count; i++) {
+		own.push_back(std::make_unique<LatencyHistogram>());
+	}
+
+	std::vector<std::thread> threads;
+	for (int i = 0; i < thread_count; i++) {
+		threads.emplace_back([&, i]() {
+			for (std::uint64_t value = 1; value <= per_thread; value++) {
+				shared->record(value * (i + 1));
+				own[i]->record(value * (i + 1));
+			}
+		});
+	}
+	for (auto& thread: threads) {
+		thread.join();
+	}
+
+	auto merged = std::make_unique<LatencyHistogram>();
+	for (auto& histogram: own) {
+		merged->merge(*histogram);
+	}
+	CHECK(shared->count() == thread_count * per_thread);
+	CHECK(merged->count() == shared->count());
+	CHECK(merged->min() == 1);
+	CHECK(merged->max() == per_thread * thread_count);
+	CHECK(merged->mean() == doctest::Approx(shared->mean()));
+	for (double percentile: {10.0, 50.0, 99.0, 99.9}) {
+		CHECK(merged->percentile(percentile) == shared->percentile(percentile));
+	}
+}
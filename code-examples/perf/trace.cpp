@@ -0,0 +1,332 @@
+/*
+ * trace.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "trace.h"
+#include "alloc_counter.h"
+#include "json.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace trace {
+
+namespace {
+
+const char* option_prefix = "--trace=";
+
+struct Event {
+	const char* name;
+	char phase;				/**< 'X' - slice, 'C' - counter */
+	std::uint64_t start_ns;
+	std::uint64_t end_ns;	/**< for slices */
+	double value;			/**< for counters */
+};
+
+/**
+ * \brief Single producer (the owning thread), single consumer (flush() under the registry mutex) ring buffer
+ */
+struct ThreadBuffer {
+	static constexpr std::size_t capacity = 1 << 14;
+	std::vector<Event> events = std::vector<Event>(capacity);
+	std::atomic<std::uint64_t> head{0};	/**< next slot to write, only the producer changes it */
+	std::atomic<std::uint64_t> tail{0};	/**< next slot to read, only the consumer changes it */
+	std::atomic<std::size_t> dropped{0};
+	int thread_id;
+	bool named = false;		/**< thread_name event written to the current file, used by the consumer */
+	bool finished = false;	/**< the thread exited, recycle after the last flush; guarded by the registry mutex */
+
+	explicit ThreadBuffer(int thread_id): thread_id{thread_id} {}
+
+	void push(const Event& event) {
+		std::uint64_t position = head.load(std::memory_order_relaxed);
+		if (position - tail.load(std::memory_order_acquire) == capacity) {
+			dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		events[position % capacity] = event;
+		head.store(position + 1, std::memory_order_release);
+	}
+};
+
+std::atomic<bool> active{false};
+std::string output_path;
+int process_id = 1;
+
+std::mutex registry_mutex;	// guards the registry and the file
+std::ofstream file;
+bool file_empty = true;		/**< no events in the file yet */
+
+int last_thread_id = 0;
+std::size_t recycled_dropped = 0;	/**< dropped events of recycled buffers */
+
+/**
+ * \brief Buffers of running threads, and of finished ones until their events are flushed
+ */
+std::vector<std::unique_ptr<ThreadBuffer>>& registry() {
+	static std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+	return buffers;
+}
+
+/**
+ * \brief Buffers of finished threads, reused by new threads
+ */
+std::vector<std::unique_ptr<ThreadBuffer>>& free_buffers() {
+	static std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+	return buffers;
+}
+
+/**
+ * \brief Moves registry()[index] to free_buffers(), the registry mutex must be held
+ */
+void recycle(std::size_t index) {
+	auto& buffers = registry();
+	recycled_dropped += buffers[index]->dropped.load(std::memory_order_relaxed);
+	free_buffers().push_back(std::move(buffers[index]));
+	buffers.erase(buffers.begin() + index);
+}
+
+/**
+ * \brief Hands the buffer of a thread back when the thread exits
+ */
+struct BufferOwner {
+	ThreadBuffer* buffer = nullptr;
+	bool exited = false;
+
+	~BufferOwner() {
+		exited = true;
+		if (!buffer) {
+			return;
+		}
+		alloc_counter::PauseScope pause;
+		std::lock_guard<std::mutex> lock{registry_mutex};
+		auto& buffers = registry();
+		for (std::size_t i = 0; i < buffers.size(); i++) {
+			if (buffers[i].get() == buffer) {
+				if (buffer->head.load(std::memory_order_relaxed) == buffer->tail.load(std::memory_order_relaxed)) {
+					recycle(i);
+				} else {
+					buffer->finished = true; // flush() recycles it after writing the events
+				}
+				break;
+			}
+		}
+		buffer = nullptr;
+	}
+};
+
+/**
+ * \return nullptr while the thread exits (events of thread_local destructors are not recorded)
+ */
+ThreadBuffer* current_buffer() {
+	thread_local BufferOwner owner;
+	if (!owner.buffer && !owner.exited) {
+		alloc_counter::PauseScope pause; // not an allocation of the traced code
+		std::lock_guard<std::mutex> lock{registry_mutex};
+		auto& unused = free_buffers();
+		std::unique_ptr<ThreadBuffer> buffer;
+		if (unused.empty()) {
+			buffer = std::make_unique<ThreadBuffer>(++last_thread_id);
+		} else {
+			buffer = std::move(unused.back());
+			unused.pop_back();
+			buffer->head.store(0, std::memory_order_relaxed);
+			buffer->tail.store(0, std::memory_order_relaxed);
+			buffer->dropped.store(0, std::memory_order_relaxed);
+			buffer->thread_id = ++last_thread_id; // a track of its own in the trace
+			buffer->named = false;
+			buffer->finished = false;
+		}
+		owner.buffer = buffer.get();
+		registry().push_back(std::move(buffer));
+	}
+	return owner.buffer;
+}
+
+void write_event(std::ostream& out, const Event& event, int thread_id) {
+	out<<"{\"name\": ";
+	write_json_string(out, event.name);
+	out<<", \"ph\": \""<<event.phase<<"\", \"pid\": "<<process_id<<", \"tid\": "<<thread_id<<", \"ts\": "<<event.start_ns / 1000.0;
+	if (event.phase == 'X') {
+		out<<", \"dur\": "<<(event.end_ns - event.start_ns) / 1000.0;
+	} else {
+		out<<", \"args\": {\"value\": "<<event.value<<"}";
+	}
+	out<<"}";
+}
+
+}
+
+std::uint64_t now_ns() {
+	static const auto epoch = std::chrono::steady_clock::now();
+	return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - epoch).count());
+}
+
+bool enabled() {
+	return active.load(std::memory_order_relaxed);
+}
+
+void record_complete(const char* name, std::uint64_t start_ns, std::uint64_t end_ns) {
+	if (ThreadBuffer* buffer = current_buffer()) {
+		buffer->push({name, 'X', start_ns, end_ns, 0});
+	}
+}
+
+void record_counter(const char* name, double value) {
+	if (ThreadBuffer* buffer = current_buffer()) {
+		buffer->push({name, 'C', now_ns(), 0, value});
+	}
+}
+
+std::size_t buffer_count() {
+	std::lock_guard<std::mutex> lock{registry_mutex};
+	return registry().size() + free_buffers().size();
+}
+
+std::size_t dropped() {
+	std::lock_guard<std::mutex> lock{registry_mutex};
+	std::size_t result = recycled_dropped;
+	for (auto& buffer: registry()) {
+		result += buffer->dropped.load(std::memory_order_relaxed);
+	}
+	return result;
+}
+
+void set_output(const std::string& path) {
+	{
+		std::lock_guard<std::mutex> lock{registry_mutex};
+		if (file.is_open()) {
+			file.close(); // unfinished, write() was not called
+		}
+		file_empty = true;
+		for (auto& buffer: registry()) {
+			buffer->named = false; // the new file needs its own thread names
+		}
+	}
+	output_path = path;
+	now_ns(); // start of the timeline
+	active.store(!path.empty(), std::memory_order_relaxed);
+}
+
+void apply_command_line(int argc, char** argv) {
+	for (int i = 1; i < argc; i++) {
+		if (std::strncmp(argv[i], option_prefix, std::strlen(option_prefix)) == 0) {
+			set_output(argv[i] + std::strlen(option_prefix));
+#ifndef TRACE_ENABLED
+			std::cerr<<"trace: TRACE_SCOPE and TRACE_COUNTER are compiled out (build with -DTRACE_ENABLED), only test cases are traced"<<std::endl;
+#endif
+		}
+	}
+}
+
+const std::string& output() {
+	return output_path;
+}
+
+void set_process_id(int id) {
+	process_id = id;
+}
+
+bool flush() {
+	alloc_counter::PauseScope pause;
+	std::lock_guard<std::mutex> lock{registry_mutex};
+	if (output_path.empty()) {
+		return false;
+	}
+	if (!file.is_open()) {
+		file.open(output_path);
+		if (!file) {
+			std::cerr<<"trace: can't write "<<output_path<<std::endl;
+			return false;
+		}
+		file<<"{\"traceEvents\": [";
+		file_empty = true;
+	}
+	auto& buffers = registry();
+	for (std::size_t index = 0; index < buffers.size();) {
+		ThreadBuffer* buffer = buffers[index].get();
+		if (!buffer->named) {
+			file<<(file_empty ? "\n" : ",\n")<<"{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": "<<process_id
+					<<", \"tid\": "<<buffer->thread_id<<", \"args\": {\"name\": \"thread "<<buffer->thread_id<<"\"}}";
+			file_empty = false;
+			buffer->named = true;
+		}
+		std::uint64_t head = buffer->head.load(std::memory_order_acquire);
+		std::uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+		for (std::uint64_t i = tail; i < head; i++) {
+			file<<",\n";
+			write_event(file, buffer->events[i % ThreadBuffer::capacity], buffer->thread_id);
+		}
+		buffer->tail.store(head, std::memory_order_release);
+		if (buffer->finished) {
+			recycle(index); // the thread can't add events
+		} else {
+			index++;
+		}
+	}
+	return static_cast<bool>(file);
+}
+
+bool write() {
+	if (!flush()) {
+		return false;
+	}
+	alloc_counter::PauseScope pause;
+	std::lock_guard<std::mutex> lock{registry_mutex};
+	std::size_t dropped_events = recycled_dropped;
+	for (auto& buffer: registry()) {
+		dropped_events += buffer->dropped.load(std::memory_order_relaxed);
+		buffer->named = false; // for the next file
+	}
+	file<<"\n],\n\"displayTimeUnit\": \"ns\", \"otherData\": {\"dropped_events\": "<<dropped_events<<"}}\n";
+	file.close();
+	return !file.fail();
+}
+
+bool merge(const std::vector<std::string>& inputs, const std::string& path) {
+	const std::string events_begin = "{\"traceEvents\": [\n";
+	const std::string events_end = "\n],\n";
+	const std::string dropped_key = "\"dropped_events\": ";
+	std::string events;
+	std::size_t dropped_events = 0;
+	for (const std::string& input: inputs) {
+		std::ifstream in{input};
+		if (!in) {
+			continue;
+		}
+		std::string text{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+		in.close();
+		std::remove(input.c_str());
+		std::size_t begin = text.find(events_begin);
+		std::size_t end = text.rfind(events_end);
+		if (begin == std::string::npos || end == std::string::npos || end < begin + events_begin.size()) {
+			continue; // no events
+		}
+		events += (events.empty() ? "" : ",\n") + text.substr(begin + events_begin.size(), end - begin - events_begin.size());
+		std::size_t dropped_position = text.find(dropped_key, end);
+		if (dropped_position != std::string::npos) {
+			dropped_events += std::stoul(text.substr(dropped_position + dropped_key.size()));
+		}
+	}
+	std::ofstream out{path};
+	if (!out) {
+		return false;
+	}
+	out<<"{\"traceEvents\": ["<<(events.empty() ? "" : "\n")<<events
+			<<"\n],\n\"displayTimeUnit\": \"ns\", \"otherData\": {\"dropped_events\": "<<dropped_events<<"}}\n";
+	return static_cast<bool>(out);
+}
+
+}
@@ -0,0 +1,147 @@
+/*
+ * trace.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_PERF_TRACE_H_
+#define CODE_EXAMPLES_PERF_TRACE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Timeline tracing in the Chrome Trace Event format (chrome://tracing, https://ui.perfetto.dev)
+ *
+ *     void DoublyLinkedList::append(T value) {
+ *         TRACE_SCOPE("DoublyLinkedList::append");    // a slice from here to the end of the scope
+ *         ...
+ *         TRACE_COUNTER("list size", _size);          // a point of a counter track
+ *     }
+ *
+ * The macros are compiled only with -DTRACE_ENABLED, otherwise they are empty and cost nothing.
+ * With tracing compiled in, events are recorded only while an output file is set (--trace=<file> of the doctest
+ * runner), otherwise a scope costs one relaxed load. The doctest listener (doctest_trace_listener.cpp) adds
+ * a slice per test case in both builds.
+ *
+ * Every thread writes into its own ring buffer (single producer, no locks); the buffer is allocated on the first
+ * event of the thread, outside of alloc_counter counting. When a buffer is full, new events are dropped and counted.
+ * flush() is the consumer: it moves the events of all threads (including finished ones) to the file,
+ * the doctest listener calls it after every test case, so only events of very busy test cases are dropped.
+ * When a thread exits, its buffer is reused by the next new thread, right away or after flush() takes
+ * the remaining events, so there are about as many buffers as threads running at the same time.
+ * Names must be string literals (or otherwise live until write()), only the pointer is stored.
+ */
+namespace trace {
+
+/**
+ * \brief Nanoseconds since the first call, steady clock
+ */
+std::uint64_t now_ns();
+
+/**
+ * \brief true while an output file is set
+ */
+bool enabled();
+
+/**
+ * \brief Slice of the calling thread from start_ns to end_ns ("X" event)
+ */
+void record_complete(const char* name, std::uint64_t start_ns, std::uint64_t end_ns);
+
+/**
+ * \brief Value of a counter at this moment ("C" event)
+ */
+void record_counter(const char* name, double value);
+
+/**
+ * \brief Number of ring buffers, of running threads and reusable ones of finished threads
+ */
+std::size_t buffer_count();
+
+/**
+ * \brief Number of events dropped because a ring buffer was full
+ */
+std::size_t dropped();
+
+/**
+ * \brief Set the JSON file, empty path disables tracing
+ *
+ * A file which is not finished by write() is closed as it is. Events which are not flushed yet go to the new file.
+ */
+void set_output(const std::string& path);
+
+/**
+ * \brief Takes "--trace=<file>" from command line arguments (if present) and sets it as the output
+ *
+ * Prints a warning if tracing is compiled out.
+ */
+void apply_command_line(int argc, char** argv);
+
+const std::string& output();
+
+/**
+ * \brief "pid" of the events, test shards are separate processes of one timeline
+ */
+void set_process_id(int id);
+
+/**
+ * \brief Move the recorded events of all threads to output(), opens it on the first call
+ *
+ * Events recorded while flushing may end up in the next flush.
+ * \return false if the file can't be written or no output is set
+ */
+bool flush();
+
+/**
+ * \brief Flush and finish the file: {"traceEvents": [...], "otherData": {"dropped_events": N}}
+ *
+ * \return false if the file can't be written or no output is set
+ */
+bool write();
+
+/**
+ * \brief Combine traces written by several processes (test shards) into one file, inputs are removed
+ * \return false if path can't be written
+ */
+bool merge(const std::vector<std::string>& inputs, const std::string& path);
+
+/**
+ * \brief Records a slice from construction to destruction
+ */
+class Scope {
+private:
+	const char* name;
+	std::uint64_t start;
+public:
+	explicit Scope(const char* name): name{enabled() ? name : nullptr}, start{this->name ? now_ns() : 0} {}
+	~Scope() {
+		if (name) {
+			record_complete(name, start, now_ns());
+		}
+	}
+	Scope(const Scope&) = delete;
+	Scope& operator=(const Scope&) = delete;
+};
+
+}
+
+#ifdef TRACE_ENABLED
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+#define TRACE_SCOPE(name) ::trace::Scope TRACE_CONCAT(trace_scope_, __LINE__){name}
+#define TRACE_COUNTER(name, value) \
+	do { \
+		if (::trace::enabled()) { \
+			::trace::record_counter(name, static_cast<double>(value)); \
+		} \
+	} while (false)
+#else
+#define TRACE_SCOPE(name) static_cast<void>(0)
+#define TRACE_COUNTER(name, value) static_cast<void>(0)
+#endif
+
+#endif /* CODE_EXAMPLES_PERF_TRACE_H_ */
@@ -0,0 +1,156 @@
+/*
+ * trace_test.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "trace.h"
+#include "../list/list.h"
+
+#include "../doctest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+std::string read_and_remove(const std::string& path) {
+	std::ifstream in{path};
+	std::stringstream buffer;
+	buffer<<in.rdbuf();
+	in.close();
+	std::remove(path.c_str());
+	return buffer.str();
+}
+
+}
+
+TEST_CASE("[trace] - scopes and counters of several threads") {
+	if (!trace::output().empty()) {
+		MESSAGE("skipped: the trace of this run is being recorded");
+		return;
+	}
+	{
+		trace::Scope disabled{"not recorded"};
+	}
+	trace::set_output("trace_test.json");
+	REQUIRE(trace::enabled());
+	{
+		trace::Scope scope{"outer \"scope\""};
+		trace::record_counter("answer", 42);
+		std::thread other{[]() {
+			trace::Scope scope{"in other thread"};
+		}};
+		other.join();
+	}
+	DoublyLinkedList<int> list;
+	list.append(1); // a slice with -DTRACE_ENABLED
+	REQUIRE(trace::write());
+	trace::set_output("");
+	CHECK_FALSE(trace::enabled());
+
+	std::string json = read_and_remove("trace_test.json");
+	CHECK(json.find("{\"traceEvents\": [") == 0);
+	CHECK(json.find("\"name\": \"outer \\\"scope\\\"\", \"ph\": \"X\"") != std::string::npos);
+	CHECK(json.find("\"name\": \"answer\", \"ph\": \"C\"") != std::string::npos);
+	CHECK(json.find("\"args\": {\"value\": 42}") != std::string::npos);
+	CHECK(json.find("\"name\": \"in other thread\"") != std::string::npos);
+	CHECK(json.find("not recorded") == std::string::npos);
+	CHECK(json.find("\"thread_name\"") != std::string::npos);
+#ifdef TRACE_ENABLED
+	CHECK(json.find("\"name\": \"DoublyLinkedList::append\"") != std::string::npos);
+#else
+	CHECK(json.find("DoublyLinkedList::append") == std::string::npos);
+#endif
+
+	SUBCASE("events are taken by write") {
+		trace::set_output("trace_test.json");
+		REQUIRE(trace::write());
+		trace::set_output("");
+		CHECK(read_and_remove("trace_test.json").find("outer") == std::string::npos);
+	}
+}
+
+TEST_CASE("[trace] - switching files mid-trace") {
+	if (!trace::output().empty()) {
+		MESSAGE("skipped: the trace of this run is being recorded");
+		return;
+	}
+	trace::set_output("trace_test_first.json");
+	{
+		trace::Scope scope{"in first file"};
+	}
+	REQUIRE(trace::flush());
+	trace::set_output("trace_test_second.json"); // the first file stays unfinished, like a shard's copy of the output
+	{
+		trace::Scope scope{"in second file"};
+	}
+	REQUIRE(trace::write());
+	trace::set_output("");
+
+	std::string first = read_and_remove("trace_test_first.json");
+	std::string second = read_and_remove("trace_test_second.json");
+	CHECK(first.find("in first file") != std::string::npos);
+	CHECK(second.find("{\"traceEvents\": [\n{\"name\": \"thread_name\"") == 0);
+	CHECK(second.find("in second file") != std::string::npos);
+	CHECK(second.find("in first file") == std::string::npos);
+}
+
+TEST_CASE("[trace] - buffers of finished threads are reused") {
+	if (!trace::output().empty()) {
+		MESSAGE("skipped: the trace of this run is being recorded");
+		return;
+	}
+	trace::set_output("trace_test.json");
+	{
+		trace::Scope scope{"main thread"};
+	}
+	REQUIRE(trace::flush());
+	std::size_t buffers = trace::buffer_count();
+	for (int i = 0; i < 8; i++) {
+		std::thread worker{[]() {
+			trace::Scope scope{"worker"};
+		}};
+		worker.join();
+		REQUIRE(trace::flush()); // takes the events of the finished thread and frees its buffer
+	}
+	CHECK(trace::buffer_count() <= buffers + 1);
+	for (int i = 0; i < 8; i++) {
+		std::thread{[]() {
+			trace::Scope scope{"unflushed worker"};
+		}}.join();
+	}
+	REQUIRE(trace::write());
+	trace::set_output("");
+	CHECK(trace::buffer_count() <= buffers + 8);
+
+	std::string json = read_and_remove("trace_test.json");
+	std::size_t workers = 0;
+	for (std::size_t position = json.find("\"worker\""); position != std::string::npos; position = json.find("\"worker\"", position + 1)) {
+		workers++;
+	}
+	CHECK(workers == 8);
+	CHECK(json.find("unflushed worker") != std::string::npos);
+}
+
+TEST_CASE("[trace] - merging traces of processes") {
+	{
+		std::ofstream first{"trace_test_merge.0"};
+		first<<"{\"traceEvents\": [\n{\"name\": \"a\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, \"ts\": 0, \"dur\": 1}\n],\n"
+				"\"displayTimeUnit\": \"ns\", \"otherData\": {\"dropped_events\": 2}}\n";
+		std::ofstream second{"trace_test_merge.1"};
+		second<<"{\"traceEvents\": [\n{\"name\": \"b\", \"ph\": \"X\", \"pid\": 2, \"tid\": 1, \"ts\": 0, \"dur\": 1}\n],\n"
+				"\"displayTimeUnit\": \"ns\", \"otherData\": {\"dropped_events\": 3}}\n";
+	}
+	REQUIRE(trace::merge({"trace_test_merge.0", "trace_test_merge.1", "missing"}, "trace_test_merge.json"));
+	std::string json = read_and_remove("trace_test_merge.json");
+	CHECK(json == "{\"traceEvents\": [\n"
+			"{\"name\": \"a\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, \"ts\": 0, \"dur\": 1},\n"
+			"{\"name\": \"b\", \"ph\": \"X\", \"pid\": 2, \"tid\": 1, \"ts\": 0, \"dur\": 1}\n"
+			"],\n\"displayTimeUnit\": \"ns\", \"otherData\": {\"dropped_events\": 5}}\n");
+	CHECK_FALSE(std::ifstream{"trace_test_merge.0"}.good());
+}
@@ -0,0 +1,142 @@
+/*
+ * rational.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#include "rational.h"
+
+#include "perf/cpu_dispatch.h"
+
+#include <cstdint>
+
+#ifdef CPU_DISPATCH_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+
+std::uint32_t magnitude(int value) {
+	return value < 0 ? 0u - static_cast<std::uint32_t>(value) : static_cast<std::uint32_t>(value);
+}
+
+/**
+ * \brief Stein's binary GCD: subtractions and shifts by the number of trailing zeros
+ */
+std::uint32_t binary_gcd(std::uint32_t u, std::uint32_t v) {
+	if (u == 0 || v == 0) {
+		return u | v;
+	}
+	int shift = __builtin_ctz(u | v);
+	u >>= __builtin_ctz(u);
+	do {
+		v >>= __builtin_ctz(v);
+		if (u > v) {
+			std::uint32_t t = u;
+			u = v;
+			v = t;
+		}
+		v -= u;
+	} while (v);
+	return u << shift;
+}
+
+void gcd_scalar(const int* a, const int* b, int* gcds, std::size_t count) {
+	for (std::size_t i = 0; i < count; i++) {
+		gcds[i] = static_cast<int>(binary_gcd(magnitude(a[i]), magnitude(b[i])));
+	}
+}
+
+#ifdef CPU_DISPATCH_X86
+
+// AVX2 has no trailing zero count: the lowest set bit x & -x converted to float has the count as its exponent
+// (2^31 converts to -2^31, the sign is masked off). 0 gives a negative count, and shifts by it give 0.
+CPU_DISPATCH_AVX2 inline __m256i trailing_zeros(__m256i x) {
+	__m256i lowest = _mm256_and_si256(x, _mm256_sub_epi32(_mm256_setzero_si256(), x));
+	__m256i exponent = _mm256_and_si256(_mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(lowest)), 23), _mm256_set1_epi32(0xff));
+	return _mm256_sub_epi32(exponent, _mm256_set1_epi32(127));
+}
+
+// Lanes with one zero operand start as gcd(x, x) = x, lanes which are done (v == 0) keep their u
+CPU_DISPATCH_AVX2 void gcd_avx2(const int* a, const int* b, int* gcds, std::size_t count) {
+	const __m256i zero = _mm256_setzero_si256();
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i u = _mm256_abs_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)));
+		__m256i v = _mm256_abs_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+		__m256i either = _mm256_or_si256(u, v);
+		u = _mm256_blendv_epi8(u, either, _mm256_cmpeq_epi32(u, zero));
+		v = _mm256_blendv_epi8(v, either, _mm256_cmpeq_epi32(v, zero));
+		__m256i shift = trailing_zeros(either);
+		u = _mm256_srlv_epi32(u, trailing_zeros(u));
+		__m256i active = _mm256_xor_si256(_mm256_cmpeq_epi32(v, zero), _mm256_set1_epi32(-1));
+		while (!_mm256_testz_si256(active, active)) {
+			v = _mm256_srlv_epi32(v, trailing_zeros(v));
+			__m256i low = _mm256_min_epu32(u, v);
+			__m256i difference = _mm256_sub_epi32(_mm256_max_epu32(u, v), low);
+			u = _mm256_blendv_epi8(u, low, active);
+			v = _mm256_blendv_epi8(v, difference, active);
+			active = _mm256_andnot_si256(_mm256_cmpeq_epi32(v, zero), active);
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(gcds + i), _mm256_sllv_epi32(u, shift));
+	}
+	gcd_scalar(a + i, b + i, gcds + i, count - i);
+}
+
+// AVX-512CD counts leading zeros: trailing zeros are 31 - lzcnt(x & -x)
+CPU_DISPATCH_AVX512 inline __m512i trailing_zeros(__m512i x) {
+	__m512i lowest = _mm512_and_si512(x, _mm512_sub_epi32(_mm512_setzero_si512(), x));
+	return _mm512_sub_epi32(_mm512_set1_epi32(31), _mm512_lzcnt_epi32(lowest));
+}
+
+// GCC 12 warns about the _mm512_undefined_epi32() which unmasked AVX-512 intrinsics pass as their merge source
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+CPU_DISPATCH_AVX512 void gcd_avx512(const int* a, const int* b, int* gcds, std::size_t count) {
+	const __m512i zero = _mm512_setzero_si512();
+	for (std::size_t i = 0; i < count; i += 16) {
+		__mmask16 mask = count - i >= 16 ? 0xffff : static_cast<__mmask16>((1u << (count - i)) - 1);
+		__m512i u = _mm512_abs_epi32(_mm512_maskz_loadu_epi32(mask, a + i));
+		__m512i v = _mm512_abs_epi32(_mm512_maskz_loadu_epi32(mask, b + i));
+		__m512i either = _mm512_or_si512(u, v);
+		u = _mm512_mask_mov_epi32(u, _mm512_cmpeq_epi32_mask(u, zero), either);
+		v = _mm512_mask_mov_epi32(v, _mm512_cmpeq_epi32_mask(v, zero), either);
+		__m512i shift = trailing_zeros(either);
+		u = _mm512_srlv_epi32(u, trailing_zeros(u));
+		__mmask16 active = _mm512_test_epi32_mask(v, v);
+		while (active) {
+			v = _mm512_mask_srlv_epi32(v, active, v, trailing_zeros(v));
+			__m512i low = _mm512_min_epu32(u, v);
+			v = _mm512_mask_sub_epi32(v, active, _mm512_max_epu32(u, v), low);
+			u = _mm512_mask_mov_epi32(u, active, low);
+			active = _mm512_mask_test_epi32_mask(active, v, v);
+		}
+		_mm512_mask_storeu_epi32(gcds + i, mask, _mm512_sllv_epi32(u, shift));
+	}
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+cpu_dispatch::Kernel<void(const int*, const int*, int*, std::size_t)>& gcd_kernel() {
+	static cpu_dispatch::Kernel<void(const int*, const int*, int*, std::size_t)> kernel{gcd_scalar, gcd_avx2, gcd_avx512};
+	return kernel;
+}
+
+#else
+
+cpu_dispatch::Kernel<void(const int*, const int*, int*, std::size_t)>& gcd_kernel() {
+	static cpu_dispatch::Kernel<void(const int*, const int*, int*, std::size_t)> kernel{gcd_scalar, nullptr, nullptr};
+	return kernel;
+}
+
+#endif
+
+}
+
+void Rational::GCD(const int* a, const int* b, int* gcds, std::size_t count) {
+	gcd_kernel()(a, b, gcds, count);
+}
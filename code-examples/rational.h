@@ -0,0 +1,122 @@
+/*
+ * rational.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: KZ
+ */
+
+#ifndef CODE_EXAMPLES_RATIONAL_H_
+#define CODE_EXAMPLES_RATIONAL_H_
+
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+class Rational {
+	int numerator;
+	int denominator;
+//private:
+//	static const Rational _one;
+public:
+	Rational(): numerator{0}, denominator{1} {}
+	Rational(int numerator, int denominator): numerator{numerator}, denominator{denominator} {}
+
+	int get_numerator() const {return numerator;}
+	int get_denominator() const {return denominator;}
+	void set_numerator(int numerator) { this->numerator = numerator; }
+	void set_denominator(int denominator) {
+		if (denominator == 0) {
+			throw std::invalid_argument("denominator");
+		}
+		this->denominator = denominator;
+	}
+
+	static const Rational zero;
+
+	static const Rational one() {
+		static const Rational _one{1,1};
+		return _one;
+	}
+
+	static Rational test_value() {
+		static Rational test_value{1,2};
+		return test_value;
+	}
+
+	static Rational& test_ref() {
+		static Rational test_value{1,2};
+		return test_value;
+	}
+
+	static int GCD(int a, int b) {
+		// this->zero; //this is unavailable in static methods
+		// Rational::zero; //static fields are available
+		return b ? GCD (b, a % b) : a;
+	}
+
+	/**
+	 * \brief gcds[i] = std::gcd(a[i], b[i]) (non-negative, unlike GCD(int, int)), binary GCD in AVX2 or AVX-512 lanes (cpu_dispatch)
+	 *
+	 * Defined in rational.cpp. Like std::gcd, the result must fit in int (not both of a[i], b[i] in {0, INT_MIN}).
+	 */
+	static void GCD(const int* a, const int* b, int* gcds, std::size_t count);
+
+	/**
+	 * \brief Fraction numerator/denominator in lowest terms with positive denominator
+	 *
+	 * Takes long long, so that results of arithmetic on int fractions can be reduced before narrowing.
+	 * \throw std::invalid_argument if denominator is 0
+	 * \throw std::overflow_error if the reduced numerator or denominator doesn't fit in int
+	 */
+	static Rational reduced(long long numerator, long long denominator) {
+		if (denominator == 0) {
+			throw std::invalid_argument("denominator");
+		}
+		if (denominator < 0) {
+			numerator = -numerator;
+			denominator = -denominator;
+		}
+		long long gcd = std::gcd(numerator, denominator);
+		numerator /= gcd;
+		denominator /= gcd;
+		if (numerator < std::numeric_limits<int>::min() || numerator > std::numeric_limits<int>::max()
+				|| denominator > std::numeric_limits<int>::max()) {
+			throw std::overflow_error("reduced fraction doesn't fit in int");
+		}
+		return Rational(static_cast<int>(numerator), static_cast<int>(denominator));
+	}
+
+	friend Rational operator+(const Rational& a, const Rational& b) {
+		return reduced(1LL*a.numerator*b.denominator + 1LL*b.numerator*a.denominator, 1LL*a.denominator*b.denominator);
+	}
+
+	friend Rational operator-(const Rational& a, const Rational& b) {
+		return reduced(1LL*a.numerator*b.denominator - 1LL*b.numerator*a.denominator, 1LL*a.denominator*b.denominator);
+	}
+
+	friend Rational operator*(const Rational& a, const Rational& b) {
+		return reduced(1LL*a.numerator*b.numerator, 1LL*a.denominator*b.denominator);
+	}
+
+	/**
+	 * \throw std::invalid_argument if b is zero
+	 */
+	friend Rational operator/(const Rational& a, const Rational& b) {
+		return reduced(1LL*a.numerator*b.denominator, 1LL*a.denominator*b.numerator);
+	}
+
+	/**
+	 * \brief Compares values, not representations: 1/2 == 2/4
+	 */
+	friend bool operator==(const Rational& a, const Rational& b) {
+		return 1LL*a.numerator*b.denominator == 1LL*b.numerator*a.denominator;
+	}
+
+	friend bool operator!=(const Rational& a, const Rational& b) {
+		return !(a == b);
+	}
+};
+
+#endif /* CODE_EXAMPLES_RATIONAL_H_ */
@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""
+Benchmark regression tracker for the Catch2 benchmarks (bench_catch).
+
+	record:  run a benchmark command several times and save the mean time of every
+	         benchmark from every run as a JSON baseline
+	compare: compare two saved runs with the Mann-Whitney U test and a bootstrap
+	         confidence interval of the ratio of medians, exit with 1 on regression
+
+Examples:
+	bench_tracker.py record --repeat 10 --out baseline.json -- ./code-examples bench_catch "[list]" -r xml
+	bench_tracker.py record --repeat 10 --out current.json -- ./code-examples bench_catch "[list]" -r xml
+	bench_tracker.py compare baseline.json current.json --threshold 5
+
+The command must print Catch2 XML results (bench_catch does it by default).
+Only the standard library is used.
+"""
+
+import argparse
+import json
+import math
+import random
+import statistics
+import subprocess
+import sys
+import xml.etree.ElementTree as ET
+
+
+def parse_catch_xml(text):
+	"""Returns {benchmark name: mean in nanoseconds} from Catch2 XML reporter output"""
+	start = text.find("<?xml")
+	root = ET.fromstring(text[start:] if start >= 0 else text)
+	result = {}
+	for test_case in root.iter("TestCase"):
+		for benchmark in test_case.iter("BenchmarkResults"):
+			mean = benchmark.find("mean")
+			if mean is None:
+				continue
+			name = test_case.get("name") + "/" + benchmark.get("name")
+			result[name] = float(mean.get("value"))
+	return result
+
+
+def record(args):
+	samples = {}
+	for i in range(args.repeat):
+		completed = subprocess.run(args.command, stdout=subprocess.PIPE, universal_newlines=True)
+		if completed.returncode != 0:
+			print("run {}: command failed with exit code {}".format(i + 1, completed.returncode), file=sys.stderr)
+			return 2
+		for name, mean in parse_catch_xml(completed.stdout).items():
+			samples.setdefault(name, []).append(mean)
+		print("run {}/{}: {} benchmarks".format(i + 1, args.repeat, len(samples)), file=sys.stderr)
+	with open(args.out, "w") as out:
+		json.dump({"command": args.command, "repeat": args.repeat, "unit": "ns", "benchmarks": samples}, out, indent=1)
+	return 0
+
+
+def mann_whitney_greater(baseline, current):
+	"""
+	One-sided Mann-Whitney U test, alternative: current values tend to be larger.
+	Returns the p-value: exact distribution for small samples without ties, normal approximation otherwise.
+	"""
+	n1, n2 = len(current), len(baseline)
+	combined = sorted([(value, 0) for value in current] + [(value, 1) for value in baseline])
+	# average ranks for ties
+	ranks = [0.0] * len(combined)
+	tie_term = 0.0
+	i = 0
+	while i < len(combined):
+		j = i
+		while j + 1 < len(combined) and combined[j + 1][0] == combined[i][0]:
+			j += 1
+		for k in range(i, j + 1):
+			ranks[k] = (i + j) / 2 + 1
+		t = j - i + 1
+		tie_term += t ** 3 - t
+		i = j + 1
+	rank_sum = sum(rank for rank, (_, group) in zip(ranks, combined) if group == 0)
+	u = rank_sum - n1 * (n1 + 1) / 2
+
+	if tie_term == 0 and n1 + n2 <= 30:
+		# counts[k] - number of rankings with U == k, built by adding one observation at a time
+		counts = exact_u_counts(n1, n2)
+		total = sum(counts)
+		return sum(counts[k] for k in range(int(u), len(counts))) / total
+
+	mean = n1 * n2 / 2
+	n = n1 + n2
+	variance = n1 * n2 / 12 * ((n + 1) - tie_term / (n * (n - 1)))
+	if variance <= 0:
+		return 1.0
+	z = (u - mean - 0.5) / math.sqrt(variance)
+	return 0.5 * math.erfc(z / math.sqrt(2))
+
+
+def exact_u_counts(n1, n2):
+	"""Number of arrangements of n1 and n2 observations for every value of U (recurrence f(n1,n2,u))"""
+	table = {}
+
+	def f(a, b):
+		if (a, b) in table:
+			return table[(a, b)]
+		if a == 0 or b == 0:
+			result = [1]
+		else:
+			# the largest observation belongs either to the first group (adds b to U) or to the second
+			with_a = [0] * b + f(a - 1, b)
+			with_b = f(a, b - 1)
+			size = max(len(with_a), len(with_b))
+			result = [(with_a[k] if k < len(with_a) else 0) + (with_b[k] if k < len(with_b) else 0) for k in range(size)]
+		table[(a, b)] = result
+		return result
+
+	return f(n1, n2)
+
+
+def bootstrap_ratio(baseline, current, iterations, confidence, rng):
+	"""Bootstrap confidence interval of median(current) / median(baseline)"""
+	ratios = []
+	for _ in range(iterations):
+		b = statistics.median(rng.choice(baseline) for _ in baseline)
+		c = statistics.median(rng.choice(current) for _ in current)
+		ratios.append(c / b if b > 0 else math.inf)
+	ratios.sort()
+	low = ratios[int((1 - confidence) / 2 * (iterations - 1))]
+	high = ratios[int((1 + confidence) / 2 * (iterations - 1))]
+	return low, high
+
+
+def compare(args):
+	with open(args.baseline) as file:
+		baseline = json.load(file)["benchmarks"]
+	with open(args.current) as file:
+		current = json.load(file)["benchmarks"]
+
+	rng = random.Random(args.seed)
+	limit = 1 + args.threshold / 100
+	regressions = 0
+	print("{:<60} {:>12} {:>12} {:>8} {:>17} {:>8}  {}".format(
+		"benchmark", "baseline ns", "current ns", "ratio", "{:.0%} CI".format(args.confidence), "p", "verdict"))
+	for name in sorted(set(baseline) | set(current)):
+		if name not in baseline or name not in current:
+			print("{:<60} {}".format(name, "only in baseline" if name in baseline else "new"))
+			continue
+		b, c = baseline[name], current[name]
+		b_median, c_median = statistics.median(b), statistics.median(c)
+		ratio = c_median / b_median if b_median > 0 else math.inf
+		low, high = bootstrap_ratio(b, c, args.bootstrap, args.confidence, rng)
+		p = mann_whitney_greater(b, c)
+		# slower beyond the threshold, significant by the test and by the whole confidence interval
+		if ratio > limit and low > limit and p < args.alpha:
+			verdict = "REGRESSION"
+			regressions += 1
+		elif ratio < 1 / limit and high < 1 / limit and mann_whitney_greater(c, b) < args.alpha:
+			verdict = "improvement"
+		else:
+			verdict = "ok"
+		print("{:<60} {:>12.2f} {:>12.2f} {:>8.3f} {:>8.3f}-{:<8.3f} {:>8.4f}  {}".format(
+			name[:60], b_median, c_median, ratio, low, high, p, verdict))
+	print("{} regression(s) over {}%".format(regressions, args.threshold))
+	return 1 if regressions else 0
+
+
+def main():
+	parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+	commands = parser.add_subparsers(dest="action", required=True)
+
+	record_parser = commands.add_parser("record", help="run benchmarks and save results")
+	record_parser.add_argument("--repeat", type=int, default=10, help="number of runs (samples per benchmark)")
+	record_parser.add_argument("--out", required=True, help="JSON file to write")
+	record_parser.add_argument("command", nargs=argparse.REMAINDER, help="benchmark command, after --")
+
+	compare_parser = commands.add_parser("compare", help="compare two saved results")
+	compare_parser.add_argument("baseline")
+	compare_parser.add_argument("current")
+	compare_parser.add_argument("--threshold", type=float, default=5.0, help="allowed slowdown in percent")
+	compare_parser.add_argument("--alpha", type=float, default=0.05, help="significance level of the test")
+	compare_parser.add_argument("--confidence", type=float, default=0.95, help="bootstrap interval confidence")
+	compare_parser.add_argument("--bootstrap", type=int, default=2000, help="bootstrap resamples")
+	compare_parser.add_argument("--seed", type=int, default=1, help="bootstrap random seed")
+
+	args = parser.parse_args()
+	if args.action == "record":
+		if args.command and args.command[0] == "--":
+			args.command = args.command[1:]
+		if not args.command:
+			parser.error("record: benchmark command is required")
+		return record(args)
+	return compare(args)
+
+
+if __name__ == "__main__":
+	sys.exit(main())